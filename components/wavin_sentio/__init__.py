@@ -1,34 +1,90 @@
 """Wavin Sentio ESPHome Component"""
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome import automation
 from esphome.components import modbus
-from esphome.const import CONF_ID
+from esphome.const import CONF_ID, CONF_TRIGGER_ID
 
 DEPENDENCIES = ["modbus"]
-AUTO_LOAD = ["climate", "sensor", "binary_sensor", "switch"]
+AUTO_LOAD = ["climate", "sensor", "binary_sensor", "switch", "number"]
 CODEOWNERS = ["@yourusername"]
+MULTI_CONF = True
 
 CONF_WAVIN_SENTIO_ID = "wavin_sentio_id"
 CONF_UPDATE_INTERVAL = "update_interval"
 CONF_POLL_CHANNELS_PER_CYCLE = "poll_channels_per_cycle"
 CONF_FLOW_CONTROL_PIN = "flow_control_pin"
 CONF_TX_ENABLE_PIN = "tx_enable_pin"
+CONF_RESPONSE_TIMEOUT = "response_timeout"
+CONF_LOOP_BUDGET = "loop_budget"
+CONF_TRACE_SIZE = "trace_size"
+CONF_HOT_PATH_LOGGING = "hot_path_logging"
+CONF_SYSTEM_UPDATE_INTERVAL = "system_update_interval"
+CONF_SYSTEM_REGISTERS = "system_registers"
+CONF_DISCOVERY_TIMEOUT = "discovery_timeout"
+CONF_MAX_RETRIES = "max_retries"
+CONF_ON_SYSTEM_CHANGE = "on_system_change"
 
 # Channel friendly names (up to 16 channels)
 CHANNEL_FRIENDLY_NAME_KEYS = [f"channel_{i:02d}_friendly_name" for i in range(1, 17)]
 
 wavin_sentio_ns = cg.esphome_ns.namespace("wavin_sentio")
 WavinSentio = wavin_sentio_ns.class_("WavinSentio", cg.PollingComponent, modbus.ModbusDevice)
+SystemDataConstRef = wavin_sentio_ns.struct("SystemData").operator("const").operator("ref")
+SystemChangeTrigger = wavin_sentio_ns.class_(
+    "SystemChangeTrigger", automation.Trigger.template(SystemDataConstRef)
+)
 
-CONFIG_SCHEMA = cv.Schema({
+
+def validate_system_registers(config):
+    if CONF_ON_SYSTEM_CHANGE in config and not config[CONF_SYSTEM_REGISTERS]:
+        raise cv.Invalid(f"'{CONF_ON_SYSTEM_CHANGE}' requires '{CONF_SYSTEM_REGISTERS}: true'")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(cv.Schema({
     cv.GenerateID(): cv.declare_id(WavinSentio),
     cv.Optional(CONF_UPDATE_INTERVAL, default="10s"): cv.positive_time_period_milliseconds,
     cv.Optional(CONF_POLL_CHANNELS_PER_CYCLE, default=2): cv.int_range(min=1, max=16),
     cv.Optional(CONF_FLOW_CONTROL_PIN): cv.positive_int,
     cv.Optional(CONF_TX_ENABLE_PIN): cv.positive_int,
+    cv.Optional(CONF_RESPONSE_TIMEOUT, default="300ms"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(milliseconds=50), max=cv.TimePeriod(milliseconds=2000)),
+    ),
+    cv.Optional(CONF_LOOP_BUDGET, default="2ms"): cv.All(
+        cv.positive_time_period_microseconds,
+        cv.Range(min=cv.TimePeriod(microseconds=200), max=cv.TimePeriod(milliseconds=20)),
+    ),
+    cv.Optional(CONF_MAX_RETRIES, default=1): cv.int_range(min=0, max=5),
+    cv.Optional(CONF_DISCOVERY_TIMEOUT, default="100ms"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(milliseconds=20), max=cv.TimePeriod(milliseconds=1000)),
+    ),
+    # The channel 0 system block is not part of the documented register map, opt-in until confirmed
+    cv.Optional(CONF_SYSTEM_REGISTERS, default=False): cv.boolean,
+    cv.Optional(CONF_SYSTEM_UPDATE_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_TRACE_SIZE, default=128): cv.int_range(min=16, max=1024),
+    cv.Optional(CONF_HOT_PATH_LOGGING, default=False): cv.boolean,
+    cv.Optional(CONF_ON_SYSTEM_CHANGE): automation.validate_automation({
+        cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(SystemChangeTrigger),
+    }),
     # Add friendly names for each channel
     **{cv.Optional(key): cv.string for key in CHANNEL_FRIENDLY_NAME_KEYS},
-}).extend(cv.polling_component_schema("10s")).extend(modbus.modbus_device_schema(0x01))
+}).extend(cv.polling_component_schema("10s")).extend(modbus.modbus_device_schema(0x01)),
+    validate_system_registers)
+
+
+def validate_compile_time_options(config):
+    # These become global build flags, so every wavin_sentio entry has to agree
+    instances = fv.full_config.get()["wavin_sentio"]
+    for key in (CONF_TRACE_SIZE, CONF_HOT_PATH_LOGGING):
+        if any(instance[key] != config[key] for instance in instances):
+            raise cv.Invalid(f"'{key}' is compile-time and must be the same on all wavin_sentio entries")
+    return config
+
+FINAL_VALIDATE_SCHEMA = validate_compile_time_options
 
 
 async def to_code(config):
@@ -43,6 +99,22 @@ async def to_code(config):
         cg.add(var.set_tx_enable_pin(config[CONF_TX_ENABLE_PIN]))
     
     cg.add(var.set_poll_channels_per_cycle(config[CONF_POLL_CHANNELS_PER_CYCLE]))
+    cg.add(var.set_response_timeout(config[CONF_RESPONSE_TIMEOUT]))
+    cg.add(var.set_loop_budget(config[CONF_LOOP_BUDGET]))
+    cg.add(var.set_system_registers(config[CONF_SYSTEM_REGISTERS]))
+    cg.add(var.set_system_update_interval(config[CONF_SYSTEM_UPDATE_INTERVAL]))
+    cg.add(var.set_discovery_timeout(config[CONF_DISCOVERY_TIMEOUT]))
+    cg.add(var.set_max_retries(config[CONF_MAX_RETRIES]))
+    
+    # Trace ring size and hot path logging are compile-time and identical on all
+    # entries (see validate_compile_time_options), build flags are de-duplicated
+    cg.add_build_flag(f"-DWAVIN_SENTIO_TRACE_SIZE={config[CONF_TRACE_SIZE]}")
+    if config[CONF_HOT_PATH_LOGGING]:
+        cg.add_build_flag("-DWAVIN_SENTIO_HOT_PATH_LOGGING")
+    
+    for conf in config.get(CONF_ON_SYSTEM_CHANGE, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(SystemDataConstRef, "x")], conf)
     
     # Set friendly names
     for i, key in enumerate(CHANNEL_FRIENDLY_NAME_KEYS, 1):
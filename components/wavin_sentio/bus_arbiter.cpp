@@ -0,0 +1,116 @@
+#include "bus_arbiter.h"
+#include "wavin_sentio.h"
+#include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+static const char *const TAG = "wavin_sentio.bus";
+
+WavinSentioBus *WavinSentioBus::get_for(modbus::Modbus *modbus) {
+  // One arbiter per RS-485 segment, kept for the lifetime of the firmware
+  static std::vector<WavinSentioBus *> buses;
+
+  for (auto *bus : buses) {
+    if (bus->modbus_ == modbus) {
+      return bus;
+    }
+  }
+
+  auto *bus = new WavinSentioBus(modbus);  // NOLINT(cppcoreguidelines-owning-memory)
+  buses.push_back(bus);
+  return bus;
+}
+
+void WavinSentioBus::register_controller(WavinSentio *controller) {
+  this->controllers_.push_back(controller);
+  ESP_LOGD(TAG, "Registered controller %u on shared bus (%u total)",
+           controller->get_address(), this->controllers_.size());
+}
+
+void WavinSentioBus::service() {
+  uint32_t now = millis();
+
+  if (this->active_ != nullptr) {
+    if (now - this->active_since_ < this->active_->get_response_timeout()) {
+      return;
+    }
+    // Keep the request while the modbus still expects this controller's reply (its
+    // send_wait_time), a reply arriving now is valid and nothing else can be sent anyway
+    if (this->modbus_->waiting_for_response == this->active_->get_address()) {
+      return;
+    }
+    // No response in time, let the owner decide whether to retry
+    WavinSentio *timed_out = this->active_;
+    this->active_ = nullptr;
+    timed_out->on_transaction_timeout();
+  }
+
+  if (this->controllers_.empty()) {
+    return;
+  }
+
+  // Wait while the modbus still expects a reply for another device on the bus
+  // (e.g. modbus_controller). A late reply carries no register address and could
+  // otherwise be taken as the answer to our next request.
+  if (this->modbus_->waiting_for_response != 0) {
+    return;
+  }
+
+  WavinSentio *next = this->select_next();
+  if (next == nullptr) {
+    return;
+  }
+
+  if (next->dispatch_transaction()) {
+    this->active_ = next;
+    this->active_since_ = now;
+  }
+}
+
+void WavinSentioBus::release(WavinSentio *controller) {
+  if (this->active_ == controller) {
+    this->active_ = nullptr;
+  }
+}
+
+WavinSentio *WavinSentioBus::select_next() {
+  const size_t count = this->controllers_.size();
+  WavinSentio *best = nullptr;
+  const Transaction *best_tx = nullptr;
+  size_t best_index = 0;
+
+  // Start after the controller served last, so on ties the others go first
+  for (size_t i = 1; i <= count; i++) {
+    size_t index = (this->last_served_ + i) % count;
+    WavinSentio *controller = this->controllers_[index];
+    const Transaction *tx = controller->peek_transaction();
+    if (tx == nullptr) {
+      continue;
+    }
+
+    bool better = false;
+    if (best_tx == nullptr) {
+      better = true;
+    } else if (tx->is_write != best_tx->is_write) {
+      better = tx->is_write;
+    } else {
+      better = static_cast<int32_t>(tx->deadline - best_tx->deadline) < 0;
+    }
+
+    if (better) {
+      best = controller;
+      best_tx = tx;
+      best_index = index;
+    }
+  }
+
+  if (best != nullptr) {
+    this->last_served_ = best_index;
+  }
+  return best;
+}
+
+}  // namespace wavin_sentio
+}  // namespace esphome
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "esphome/components/modbus/modbus.h"
+#include <vector>
+
+namespace esphome {
+namespace wavin_sentio {
+
+class WavinSentio;
+
+// A single queued Modbus request for one controller
+struct Transaction {
+  uint8_t channel{0};
+  uint8_t offset{0};
+  uint8_t count{1};        // Registers in a block read
+  uint16_t value{0};       // Payload for writes
+  bool is_write{false};
+  bool input{false};       // Read input registers (0x04) instead of holding registers (0x03)
+  bool probe{false};       // Startup discovery probe, short timeout and no retries
+  uint8_t attempts{0};
+  uint32_t deadline{0};    // millis() by which the request should be on the wire
+};
+
+// Bus arbiter shared by all WavinSentio instances on the same modbus parent.
+// Only one request may be outstanding on an RS-485 segment, so the arbiter
+// decides which controller gets the bus next:
+//   1. Pending writes on any controller go before reads
+//   2. Otherwise the earliest deadline wins
+//   3. Ties are broken round-robin so no controller is starved
+class WavinSentioBus {
+ public:
+  // Returns the arbiter for this modbus parent, creating it on first use
+  static WavinSentioBus *get_for(modbus::Modbus *modbus);
+
+  void register_controller(WavinSentio *controller);
+
+  // Called from every controller's loop(), cheap when nothing is due
+  void service();
+
+  // Called by the controller owning the in-flight request once it completed
+  void release(WavinSentio *controller);
+
+  bool is_busy() const { return this->active_ != nullptr; }
+  size_t get_controller_count() const { return this->controllers_.size(); }
+
+ protected:
+  explicit WavinSentioBus(modbus::Modbus *modbus) : modbus_(modbus) {}
+
+  WavinSentio *select_next();
+
+  modbus::Modbus *modbus_;
+  std::vector<WavinSentio *> controllers_;
+  WavinSentio *active_{nullptr};
+  uint32_t active_since_{0};
+  size_t last_served_{0};
+};
+
+}  // namespace wavin_sentio
+}  // namespace esphome
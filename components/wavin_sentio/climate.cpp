@@ -1,5 +1,6 @@
 #include "climate.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 
 namespace esphome {
 namespace wavin_sentio {
@@ -11,6 +12,12 @@ static const float MIN_TEMPERATURE = 10.0f;
 static const float MAX_TEMPERATURE = 30.0f;
 static const float TEMPERATURE_STEP = 0.5f;
 
+// X19 - Temperature setpoint (×100)
+static const uint8_t REG_SETPOINT = 19;
+
+// Give up on a committed setpoint the controller never reports back
+static const uint32_t CONFIRM_TIMEOUT_MS = 60000;
+
 void WavinSentioClimate::setup() {
   if (this->parent_ == nullptr) {
     ESP_LOGE(TAG, "Parent component not set!");
@@ -42,15 +49,27 @@ void WavinSentioClimate::setup() {
     ESP_LOGCONFIG(TAG, "  Floor Temperature Mode: %s", 
                   this->use_floor_temperature_ ? "YES" : "NO");
   }
+  
+  this->parent_->register_entity(this);
+  this->parent_->add_on_write_failed_callback(
+      [this](uint8_t channel, uint8_t offset) { this->on_write_failed(channel, offset); });
 }
 
-void WavinSentioClimate::loop() {
-  // Update state from parent component data
-  this->update_state();
+uint32_t WavinSentioClimate::get_channel_mask() const {
+  if (!this->is_group_) {
+    return 1UL << this->channel_;
+  }
+  
+  uint32_t mask = 0;
+  for (uint8_t member : this->members_) {
+    mask |= 1UL << member;
+  }
+  return mask;
 }
 
 void WavinSentioClimate::dump_config() {
   LOG_CLIMATE("", "Wavin Sentio Climate", this);
+  ESP_LOGCONFIG(TAG, "  Commit Delay: %u ms", this->commit_delay_);
   if (this->is_group_) {
     ESP_LOGCONFIG(TAG, "  Group Members: %u channels", this->members_.size());
     for (uint8_t member : this->members_) {
@@ -106,34 +125,12 @@ void WavinSentioClimate::control(const climate::ClimateCall &call) {
     // Round to nearest 0.5°C
     target = roundf(target * 2.0f) / 2.0f;
     
+    // Show the requested setpoint right away, the bus write follows once the
+    // user stops adjusting - restarting the timeout collapses nudges into one write
     this->target_temperature = target;
-    
-    // Write to device
-    if (this->is_group_) {
-      // Write same setpoint to all members
-      bool all_success = true;
-      for (uint8_t member : this->members_) {
-        uint16_t raw_value = static_cast<uint16_t>(target * 100.0f);
-        if (!this->parent_->write_register(member, 19, raw_value)) {
-          ESP_LOGW(TAG, "Failed to write setpoint to member channel %u", member);
-          all_success = false;
-        } else {
-          ESP_LOGI(TAG, "Set channel %u setpoint to %.1f°C", member, target);
-        }
-      }
-      
-      if (all_success) {
-        ESP_LOGI(TAG, "Set group setpoint to %.1f°C", target);
-      }
-    } else {
-      // Write to single channel
-      uint16_t raw_value = static_cast<uint16_t>(target * 100.0f);
-      if (this->parent_->write_register(this->channel_, 19, raw_value)) {
-        ESP_LOGI(TAG, "Set channel %u setpoint to %.1f°C", this->channel_, target);
-      } else {
-        ESP_LOGW(TAG, "Failed to write setpoint to channel %u", this->channel_);
-      }
-    }
+    this->pending_target_ = target;
+    this->pending_committed_ = false;
+    this->set_timeout("commit", this->commit_delay_, [this]() { this->commit_setpoint(); });
   }
   
   this->publish_state();
@@ -146,8 +143,10 @@ void WavinSentioClimate::update_state() {
     this->target_temperature = this->calculate_average_target_temperature();
     
     // Action: heating if any member is heating
-    if (this->is_any_member_heating()) {
-      this->action = climate::CLIMATE_ACTION_HEATING;
+    if (this->parent_->is_system_blocked()) {
+      this->action = climate::CLIMATE_ACTION_IDLE;
+    } else if (this->is_any_member_heating()) {
+      this->action = this->get_active_action();
     } else {
       this->action = climate::CLIMATE_ACTION_IDLE;
     }
@@ -180,9 +179,11 @@ void WavinSentioClimate::update_state() {
     // Determine action based on mode register
     // Mode register values (from Sentio documentation):
     // 1 = IDLE, 2 = HEATING, 3 = COOLING, 4 = BLOCKED_HEATING, 5 = BLOCKED_COOLING
-    switch (data->mode) {
-      case 2:  // HEATING
-        this->action = climate::CLIMATE_ACTION_HEATING;
+    // While the whole system is blocked zone modes are not polled, so treat as idle
+    uint16_t mode = this->parent_->is_system_blocked() ? 1 : data->mode;
+    switch (mode) {
+      case 2:  // HEATING, or cooling while the system is switched to cooling
+        this->action = this->get_active_action();
         break;
       case 3:  // COOLING (if supported)
         this->action = climate::CLIMATE_ACTION_COOLING;
@@ -196,10 +197,108 @@ void WavinSentioClimate::update_state() {
     }
   }
   
+  // Pending setpoint overrides the polled value until a poll confirms it
+  if (!std::isnan(this->pending_target_)) {
+    if (this->pending_committed_ && this->is_setpoint_confirmed(this->pending_target_)) {
+      ESP_LOGD(TAG, "Setpoint %.1f°C confirmed", this->pending_target_);
+      this->pending_target_ = NAN;
+    } else if (this->pending_committed_ && millis() - this->committed_at_ > CONFIRM_TIMEOUT_MS) {
+      ESP_LOGW(TAG, "Setpoint %.1f°C not confirmed by the controller, showing polled value", 
+               this->pending_target_);
+      this->pending_target_ = NAN;
+    } else {
+      this->target_temperature = this->pending_target_;
+    }
+  }
+  
   // Publish updated state to Home Assistant
   this->publish_state();
 }
 
+void WavinSentioClimate::commit_setpoint() {
+  if (std::isnan(this->pending_target_)) {
+    return;
+  }
+  
+  float target = this->pending_target_;
+  uint16_t raw_value = static_cast<uint16_t>(target * 100.0f);
+  bool all_success = true;
+  uint32_t queued = 0;
+  
+  // Write same setpoint to all discovered members of a group, then read it back for confirmation
+  std::vector<uint8_t> channels = this->is_group_ ? this->members_ : std::vector<uint8_t>{this->channel_};
+  for (uint8_t channel : channels) {
+    if (!this->parent_->is_channel_discovered(channel)) {
+      continue;
+    }
+    if (this->parent_->write_register(channel, REG_SETPOINT, raw_value)) {
+      queued |= 1UL << channel;
+      this->parent_->read_register(channel, REG_SETPOINT);
+      ESP_LOGI(TAG, "Queued channel %u setpoint %.1f°C", channel, target);
+    } else {
+      ESP_LOGW(TAG, "Failed to queue setpoint for channel %u", channel);
+      all_success = false;
+    }
+  }
+  
+  if (!all_success || queued == 0) {
+    // Nothing to confirm, fall back to the polled value
+    this->pending_target_ = NAN;
+    this->update_state();
+    return;
+  }
+  
+  this->pending_committed_ = true;
+  this->committed_at_ = millis();
+  this->committed_sequence_ = this->parent_->get_decode_sequence();
+  this->committed_mask_ = queued;
+}
+
+void WavinSentioClimate::on_write_failed(uint8_t channel, uint8_t offset) {
+  if (offset != REG_SETPOINT || std::isnan(this->pending_target_) || !this->pending_committed_) {
+    return;
+  }
+  if ((this->committed_mask_ & (1UL << channel)) == 0) {
+    return;
+  }
+  
+  // The setpoint never reached the controller, stop showing it
+  ESP_LOGW(TAG, "Setpoint %.1f°C could not be written to channel %u, showing polled value", 
+           this->pending_target_, channel);
+  this->pending_target_ = NAN;
+  this->update_state();
+}
+
+climate::ClimateAction WavinSentioClimate::get_active_action() const {
+  // Active zones follow the controller-wide heating/cooling mode when it is known
+  return this->parent_->get_system_data().is_cooling() ? climate::CLIMATE_ACTION_COOLING
+                                                        : climate::CLIMATE_ACTION_HEATING;
+}
+
+bool WavinSentioClimate::is_setpoint_confirmed(float target) {
+  std::vector<uint8_t> channels = this->is_group_ ? this->members_ : std::vector<uint8_t>{this->channel_};
+  uint8_t confirmed = 0;
+  for (uint8_t channel : channels) {
+    ChannelData *data = this->parent_->get_channel_data(channel);
+    // Only channels written by this commit can confirm it
+    if (data == nullptr || (this->committed_mask_ & (1UL << channel)) == 0) {
+      continue;
+    }
+    // Needs the ack of this commit's write and a setpoint read decoded after it,
+    // anything older may still hold the value from before the write
+    if (static_cast<int32_t>(data->setpoint_write_sequence - this->committed_sequence_) <= 0 ||
+        static_cast<int32_t>(data->setpoint_read_sequence - data->setpoint_write_sequence) <= 0) {
+      return false;
+    }
+    if (std::isnan(data->target_temperature) || std::fabs(data->target_temperature - target) > 0.01f) {
+      return false;
+    }
+    confirmed++;
+  }
+  // At least one channel has to read the value back
+  return confirmed > 0;
+}
+
 float WavinSentioClimate::calculate_average_temperature() {
   float sum = 0.0f;
   uint8_t count = 0;
@@ -8,12 +8,11 @@
 namespace esphome {
 namespace wavin_sentio {
 
-class WavinSentioClimate : public climate::Climate, public Component {
+class WavinSentioClimate : public climate::Climate, public Component, public WavinSentioEntity {
  public:
   WavinSentioClimate() = default;
   
   void setup() override;
-  void loop() override;
   void dump_config() override;
   
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -29,12 +28,21 @@ class WavinSentioClimate : public climate::Climate, public Component {
     this->is_group_ = true;
   }
   void set_use_floor_temperature(bool use_floor) { this->use_floor_temperature_ = use_floor; }
+  void set_commit_delay(uint32_t delay_ms) { this->commit_delay_ = delay_ms; }
   
   climate::ClimateTraits traits() override;
   
+  // Published by the parent when one of the channels has new data
+  void publish_from_parent() override { this->update_state(); }
+  uint32_t get_channel_mask() const override;
+  
  protected:
   void control(const climate::ClimateCall &call) override;
   void update_state();
+  void commit_setpoint();
+  void on_write_failed(uint8_t channel, uint8_t offset);
+  bool is_setpoint_confirmed(float target);
+  climate::ClimateAction get_active_action() const;
   
   WavinSentio *parent_{nullptr};
   uint8_t channel_{0};
@@ -42,6 +50,14 @@ class WavinSentioClimate : public climate::Climate, public Component {
   bool is_group_{false};
   bool use_floor_temperature_{false};
   
+  // Optimistic setpoint shown until a poll confirms it
+  uint32_t commit_delay_{1500};
+  float pending_target_{NAN};
+  bool pending_committed_{false};
+  uint32_t committed_at_{0};
+  uint32_t committed_sequence_{0};  // Parent decode sequence when the write was queued
+  uint32_t committed_mask_{0};      // Channels the setpoint was written to
+  
   // For group climates - aggregate values
   float calculate_average_temperature();
   float calculate_average_target_temperature();
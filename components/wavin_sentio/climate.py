@@ -9,6 +9,7 @@ DEPENDENCIES = ["wavin_sentio"]
 
 CONF_MEMBERS = "members"
 CONF_USE_FLOOR_TEMPERATURE = "use_floor_temperature"
+CONF_COMMIT_DELAY = "commit_delay"
 
 WavinSentioClimate = wavin_sentio_ns.class_("WavinSentioClimate", climate.Climate, cg.Component)
 
@@ -20,6 +21,10 @@ CONFIG_SCHEMA = climate.climate_schema(
     cv.Optional(CONF_CHANNEL): cv.int_range(min=1, max=16),
     cv.Optional(CONF_MEMBERS): cv.ensure_list(cv.int_range(min=1, max=16)),
     cv.Optional(CONF_USE_FLOOR_TEMPERATURE, default=False): cv.boolean,
+    cv.Optional(CONF_COMMIT_DELAY, default="1500ms"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(max=cv.TimePeriod(seconds=10)),
+    ),
 }).extend(cv.COMPONENT_SCHEMA)
 
 # Validate that either channel or members is specified, but not both
@@ -57,3 +62,5 @@ async def to_code(config):
     
     if config.get(CONF_USE_FLOOR_TEMPERATURE, False):
         cg.add(var.set_use_floor_temperature(True))
+    
+    cg.add(var.set_commit_delay(config[CONF_COMMIT_DELAY]))
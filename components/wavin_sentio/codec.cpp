@@ -0,0 +1,72 @@
+#include "codec.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+ResponseCheck check_read_response(const uint8_t *data, size_t size, uint8_t count) {
+  const size_t expected = static_cast<size_t>(count) * 2;
+  if (data == nullptr || count == 0 || size < expected) {
+    return RESPONSE_SHORT;
+  }
+  if (size > expected) {
+    return RESPONSE_LENGTH;
+  }
+  return RESPONSE_OK;
+}
+
+ResponseCheck check_write_response(const uint8_t *data, size_t size, uint16_t address, uint16_t value) {
+  if (data == nullptr || size < 4) {
+    return RESPONSE_SHORT;
+  }
+  if (size > 4) {
+    return RESPONSE_LENGTH;
+  }
+  if (get_register_value(data, 0) != address || get_register_value(data, 1) != value) {
+    return RESPONSE_BAD_ECHO;
+  }
+  return RESPONSE_OK;
+}
+
+ExceptionClass classify_exception(uint8_t exception_code) {
+  switch (exception_code) {
+    case 0x01:  // Illegal function
+    case 0x02:  // Illegal data address
+      return EXCEPTION_UNSUPPORTED;
+    case 0x05:  // Acknowledge, request accepted but still being processed
+    case 0x06:  // Slave device busy
+      return EXCEPTION_BUSY;
+    default:
+      return EXCEPTION_FAILED;
+  }
+}
+
+float decode_air_temperature(uint16_t raw_value) {
+  // Temperature is stored as value * 100
+  float temperature = raw_value / 100.0f;
+  // Sanity check - temperature should be reasonable (5-40°C typically)
+  return (temperature > 5.0f && temperature < 50.0f) ? temperature : NAN;
+}
+
+float decode_floor_temperature(uint16_t raw_value) {
+  float temperature = raw_value / 100.0f;
+  // Floor sensor detection: valid readings are > 1°C and < 90°C
+  return (temperature > 1.0f && temperature < 90.0f) ? temperature : NAN;
+}
+
+float decode_humidity(uint16_t raw_value) {
+  float humidity = raw_value / 100.0f;
+  return (humidity >= 0.0f && humidity <= 100.0f) ? humidity : NAN;
+}
+
+float decode_setpoint(uint16_t raw_value) {
+  float setpoint = raw_value / 100.0f;
+  return (setpoint > 5.0f && setpoint < 35.0f) ? setpoint : NAN;
+}
+
+float decode_outdoor_temperature(uint16_t raw_value) {
+  float temperature = static_cast<int16_t>(raw_value) / 100.0f;
+  return (temperature > -50.0f && temperature < 70.0f) ? temperature : NAN;
+}
+
+}  // namespace wavin_sentio
+}  // namespace esphome
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace wavin_sentio {
+
+// Response validation and register decoding. Kept free of ESPHome
+// dependencies so the same code can be exercised on a host.
+
+enum ResponseCheck : uint8_t {
+  RESPONSE_OK = 0,
+  RESPONSE_SHORT,       // Fewer bytes than the request asked for
+  RESPONSE_LENGTH,      // More bytes than requested, framing is off
+  RESPONSE_BAD_ECHO,    // Write echo does not match the request
+};
+
+// Modbus exception responses, grouped by what the caller should do next
+enum ExceptionClass : uint8_t {
+  EXCEPTION_UNSUPPORTED = 0,  // Illegal function or data address, asking again gets the same answer
+  EXCEPTION_BUSY,             // Acknowledge or device busy, worth retrying
+  EXCEPTION_FAILED,           // Anything else, this request failed
+};
+
+// data/size is the payload handed to on_modbus_data(): register values for
+// reads, echoed address and value for single register writes
+ResponseCheck check_read_response(const uint8_t *data, size_t size, uint8_t count);
+ResponseCheck check_write_response(const uint8_t *data, size_t size, uint16_t address, uint16_t value);
+ExceptionClass classify_exception(uint8_t exception_code);
+
+inline uint16_t get_register_value(const uint8_t *data, size_t index) {
+  return (static_cast<uint16_t>(data[index * 2]) << 8) | data[index * 2 + 1];
+}
+
+// Register decoders return NAN when the raw value is outside the plausible window
+float decode_air_temperature(uint16_t raw_value);      // 5-50°C
+float decode_floor_temperature(uint16_t raw_value);    // 1-90°C, NAN without floor probe
+float decode_humidity(uint16_t raw_value);             // 0-100%
+float decode_setpoint(uint16_t raw_value);             // 5-35°C
+float decode_outdoor_temperature(uint16_t raw_value);  // -50-70°C signed, NAN without sensor
+
+}  // namespace wavin_sentio
+}  // namespace esphome
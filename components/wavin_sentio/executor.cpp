@@ -0,0 +1,68 @@
+#include "executor.h"
+#include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+void CooperativeExecutor::add_task(const char *name, Step &&step) {
+  Task task;
+  task.name = name;
+  task.step = std::move(step);
+  this->tasks_.push_back(std::move(task));
+}
+
+void CooperativeExecutor::run() {
+  if (this->tasks_.empty()) {
+    return;
+  }
+
+  const uint32_t start = micros();
+  size_t idle = 0;  // Consecutive steps that reported nothing left to do
+  bool overrun = false;
+
+  while (idle < this->tasks_.size()) {
+    // Don't start another step once the budget is used up, the rest waits for the next loop()
+    if (micros() - start >= this->budget_us_) {
+      this->exhausted_++;
+      break;
+    }
+
+    Task &task = this->tasks_[this->cursor_];
+    this->cursor_ = (this->cursor_ + 1) % this->tasks_.size();
+
+    const uint32_t step_start = micros();
+    if (task.step()) {
+      idle = 0;
+    } else {
+      idle++;
+    }
+
+    // A single step longer than the whole budget can't be fixed by deferring work
+    if (micros() - step_start > this->budget_us_) {
+      task.overruns++;
+      overrun = true;
+    }
+  }
+
+  const uint32_t elapsed = micros() - start;
+  if (elapsed > this->max_run_us_) {
+    this->max_run_us_ = elapsed;
+  }
+  if (overrun) {
+    this->overruns_++;
+  }
+}
+
+void CooperativeExecutor::dump_config(const char *tag) const {
+  ESP_LOGCONFIG(tag, "  Loop Budget: %u us (max run %u us, %u overruns, %u exhausted)",
+                this->budget_us_, this->max_run_us_, this->overruns_, this->exhausted_);
+  for (const auto &task : this->tasks_) {
+    if (task.overruns > 0) {
+      ESP_LOGCONFIG(tag, "    Task '%s': %u step overruns", task.name, task.overruns);
+    }
+  }
+}
+
+}  // namespace wavin_sentio
+}  // namespace esphome
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace wavin_sentio {
+
+// Small cooperative scheduler for work done in loop().
+// Each task is a step function returning true while it has more work pending.
+// Steps are run round-robin until the per-loop budget is used up, the next
+// loop() resumes with the task after the last one that ran.
+class CooperativeExecutor {
+ public:
+  using Step = std::function<bool()>;
+
+  void add_task(const char *name, Step &&step);
+  void set_budget_us(uint32_t budget_us) { this->budget_us_ = budget_us; }
+
+  // Call once per loop()
+  void run();
+
+  void dump_config(const char *tag) const;
+
+  uint32_t get_budget_us() const { return this->budget_us_; }
+  // Runs in which a single step took longer than the whole budget
+  uint32_t get_overruns() const { return this->overruns_; }
+  // Runs that stopped at the budget with work left for the next loop()
+  uint32_t get_exhausted() const { return this->exhausted_; }
+  uint32_t get_max_run_us() const { return this->max_run_us_; }
+
+ protected:
+  struct Task {
+    const char *name;
+    Step step;
+    uint32_t overruns{0};  // Single steps that exceeded the whole budget
+  };
+
+  std::vector<Task> tasks_;
+  size_t cursor_{0};
+  uint32_t budget_us_{2000};
+  uint32_t overruns_{0};
+  uint32_t exhausted_{0};
+  uint32_t max_run_us_{0};
+};
+
+}  // namespace wavin_sentio
+}  // namespace esphome
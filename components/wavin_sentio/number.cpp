@@ -0,0 +1,53 @@
+#include "number.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+static const char *const TAG = "wavin_sentio.number";
+
+void WavinSentioNumber::setup() {
+  if (this->parent_ == nullptr) {
+    ESP_LOGE(TAG, "Parent component not set!");
+    this->mark_failed();
+    return;
+  }
+  
+  // Start from the YAML value, a previously tuned value overrides it
+  float value = this->parent_->get_tuning(this->parameter_);
+  
+  if (this->restore_value_) {
+    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
+    float restored;
+    if (this->pref_.load(&restored) && this->parent_->set_tuning(this->parameter_, restored)) {
+      ESP_LOGD(TAG, "Restored %s: %.2f", this->get_name().c_str(), restored);
+      value = restored;
+    }
+  }
+  
+  this->publish_state(value);
+}
+
+void WavinSentioNumber::dump_config() {
+  LOG_NUMBER("", "Wavin Sentio Number", this);
+  ESP_LOGCONFIG(TAG, "  Parameter: %u", static_cast<uint8_t>(this->parameter_));
+  ESP_LOGCONFIG(TAG, "  Restore Value: %s", this->restore_value_ ? "YES" : "NO");
+}
+
+void WavinSentioNumber::control(float value) {
+  if (!this->parent_->set_tuning(this->parameter_, value)) {
+    ESP_LOGW(TAG, "Rejected %.2f for %s", value, this->get_name().c_str());
+    // Report back the value still in effect
+    this->publish_state(this->parent_->get_tuning(this->parameter_));
+    return;
+  }
+  
+  this->publish_state(value);
+  
+  if (this->restore_value_) {
+    this->pref_.save(&value);
+  }
+}
+
+}  // namespace wavin_sentio
+}  // namespace esphome
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include "esphome/components/number/number.h"
+#include "wavin_sentio.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+class WavinSentioNumber : public number::Number, public Component {
+ public:
+  WavinSentioNumber() = default;
+
+  void setup() override;
+  void dump_config() override;
+
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  // Configuration methods
+  void set_parent(WavinSentio *parent) { this->parent_ = parent; }
+  void set_parameter(TuningParameter parameter) { this->parameter_ = parameter; }
+  void set_restore_value(bool restore_value) { this->restore_value_ = restore_value; }
+
+ protected:
+  void control(float value) override;
+
+  WavinSentio *parent_{nullptr};
+  TuningParameter parameter_{TuningParameter::TUNING_UPDATE_INTERVAL};
+  bool restore_value_{true};
+  ESPPreferenceObject pref_;
+};
+
+}  // namespace wavin_sentio
+}  // namespace esphome
@@ -0,0 +1,57 @@
+"""Number platform for Wavin Sentio - runtime tuning of polling parameters"""
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import number
+from esphome.const import (
+    CONF_ID,
+    CONF_TYPE,
+    CONF_RESTORE_VALUE,
+    CONF_UNIT_OF_MEASUREMENT,
+    ENTITY_CATEGORY_CONFIG,
+    UNIT_CELSIUS,
+    UNIT_MILLISECOND,
+    UNIT_PERCENT,
+    UNIT_SECOND,
+)
+from . import wavin_sentio_ns, CONF_WAVIN_SENTIO_ID, WavinSentio
+
+DEPENDENCIES = ["wavin_sentio"]
+
+WavinSentioNumber = wavin_sentio_ns.class_("WavinSentioNumber", number.Number, cg.Component)
+TuningParameter = wavin_sentio_ns.enum("TuningParameter")
+
+# type: (enum value, min, max, step, unit) - ranges match WavinSentio::set_tuning()
+NUMBER_TYPES = {
+    "update_interval": (TuningParameter.TUNING_UPDATE_INTERVAL, 1, 3600, 1, UNIT_SECOND),
+    "system_update_interval": (TuningParameter.TUNING_SYSTEM_UPDATE_INTERVAL, 10, 3600, 1, UNIT_SECOND),
+    "poll_channels_per_cycle": (TuningParameter.TUNING_POLL_CHANNELS_PER_CYCLE, 1, 16, 1, None),
+    "response_timeout": (TuningParameter.TUNING_RESPONSE_TIMEOUT, 50, 2000, 10, UNIT_MILLISECOND),
+    "max_retries": (TuningParameter.TUNING_MAX_RETRIES, 0, 5, 1, None),
+    "temperature_deadband": (TuningParameter.TUNING_TEMPERATURE_DEADBAND, 0, 5, 0.05, UNIT_CELSIUS),
+    "humidity_deadband": (TuningParameter.TUNING_HUMIDITY_DEADBAND, 0, 20, 0.5, UNIT_PERCENT),
+}
+
+CONFIG_SCHEMA = number.number_schema(
+    WavinSentioNumber,
+    entity_category=ENTITY_CATEGORY_CONFIG,
+).extend({
+    cv.GenerateID(CONF_WAVIN_SENTIO_ID): cv.use_id(WavinSentio),
+    cv.Required(CONF_TYPE): cv.one_of(*NUMBER_TYPES, lower=True),
+    cv.Optional(CONF_RESTORE_VALUE, default=True): cv.boolean,
+}).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    parameter, min_value, max_value, step, unit = NUMBER_TYPES[config[CONF_TYPE]]
+    
+    var = await number.new_number(config, min_value=min_value, max_value=max_value, step=step)
+    await cg.register_component(var, config)
+    
+    parent = await cg.get_variable(config[CONF_WAVIN_SENTIO_ID])
+    cg.add(var.set_parent(parent))
+    cg.add(var.set_parameter(parameter))
+    cg.add(var.set_restore_value(config[CONF_RESTORE_VALUE]))
+    
+    # The unit lives in the number traits
+    if unit is not None and not config.get(CONF_UNIT_OF_MEASUREMENT):
+        cg.add(var.traits.set_unit_of_measurement(unit))
@@ -14,25 +14,26 @@ void WavinSentioSensor::setup() {
     return;
   }
   
-  if (this->channel_ == 0) {
+  if (this->channel_ == 0 && !this->is_diagnostic()) {
     ESP_LOGE(TAG, "Channel not set!");
     this->mark_failed();
     return;
   }
   
   ESP_LOGCONFIG(TAG, "Setting up Wavin Sentio Sensor");
-  ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  if (!this->is_diagnostic()) {
+    ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  }
   ESP_LOGCONFIG(TAG, "  Type: %u", static_cast<uint8_t>(this->sensor_type_));
-}
-
-void WavinSentioSensor::loop() {
-  // Read value from parent component and publish
-  this->update();
+  
+  this->parent_->register_entity(this);
 }
 
 void WavinSentioSensor::dump_config() {
   LOG_SENSOR("", "Wavin Sentio Sensor", this);
-  ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  if (!this->is_diagnostic()) {
+    ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  }
   
   const char *type_str = "Unknown";
   switch (this->sensor_type_) {
@@ -51,11 +52,34 @@ void WavinSentioSensor::dump_config() {
     case SensorType::HUMIDITY:
       type_str = "Humidity";
       break;
+    case SensorType::THROUGHPUT:
+      type_str = "Throughput";
+      break;
+    case SensorType::TRANSACTIONS_OK:
+      type_str = "Transactions OK";
+      break;
+    case SensorType::TRANSACTIONS_FAILED:
+      type_str = "Transactions Failed";
+      break;
+    case SensorType::LOOP_BUDGET_OVERRUNS:
+      type_str = "Loop Budget Overruns";
+      break;
+    case SensorType::LOOP_BUDGET_EXHAUSTED:
+      type_str = "Loop Budget Exhausted";
+      break;
+    case SensorType::LOOP_MAX_RUN:
+      type_str = "Loop Max Run";
+      break;
   }
   ESP_LOGCONFIG(TAG, "  Sensor Type: %s", type_str);
 }
 
 void WavinSentioSensor::update() {
+  if (this->is_diagnostic()) {
+    this->publish_state(this->get_diagnostic_value());
+    return;
+  }
+  
   // Get channel data from parent
   ChannelData *data = this->parent_->get_channel_data(this->channel_);
   
@@ -89,7 +113,7 @@ void WavinSentioSensor::update() {
         value = data->floor_temperature;
       } else {
         // Don't publish if floor sensor not present
-        ESP_LOGV(TAG, "Channel %u has no floor sensor", this->channel_);
+        SENTIO_HOT_LOGV(TAG, "Channel %u has no floor sensor", this->channel_);
         return;
       }
       break;
@@ -109,16 +133,55 @@ void WavinSentioSensor::update() {
       return;
   }
   
+  // Skip measurement changes within the configured deadband, setpoints are
+  // discrete user-driven steps and always published
+  float deadband = 0.0f;
+  switch (this->sensor_type_) {
+    case SensorType::TEMPERATURE:
+    case SensorType::FLOOR_TEMPERATURE:
+      deadband = this->parent_->get_temperature_deadband();
+      break;
+    case SensorType::HUMIDITY:
+      deadband = this->parent_->get_humidity_deadband();
+      break;
+    default:
+      break;
+  }
+  // Compared against the last raw value, state has already been through the sensor's filters
+  float last = this->get_raw_state();
+  if (deadband > 0.0f && !std::isnan(last) && !std::isnan(value) && std::fabs(value - last) < deadband) {
+    return;
+  }
+  
   // Only publish if value is valid (not NAN)
   if (!std::isnan(value)) {
     this->publish_state(value);
-    ESP_LOGV(TAG, "Channel %u sensor type %u: %.2f", 
+    SENTIO_HOT_LOGV(TAG, "Channel %u sensor type %u: %.2f", 
              this->channel_, static_cast<uint8_t>(this->sensor_type_), value);
   } else {
-    ESP_LOGV(TAG, "Channel %u sensor type %u: value is NAN", 
+    SENTIO_HOT_LOGV(TAG, "Channel %u sensor type %u: value is NAN", 
              this->channel_, static_cast<uint8_t>(this->sensor_type_));
   }
 }
 
+float WavinSentioSensor::get_diagnostic_value() const {
+  switch (this->sensor_type_) {
+    case SensorType::THROUGHPUT:
+      return this->parent_->get_throughput();
+    case SensorType::TRANSACTIONS_OK:
+      return this->parent_->get_transactions_ok();
+    case SensorType::TRANSACTIONS_FAILED:
+      return this->parent_->get_transactions_failed();
+    case SensorType::LOOP_BUDGET_OVERRUNS:
+      return this->parent_->get_loop_budget_overruns();
+    case SensorType::LOOP_BUDGET_EXHAUSTED:
+      return this->parent_->get_loop_budget_exhausted();
+    case SensorType::LOOP_MAX_RUN:
+      return this->parent_->get_loop_max_run_us();
+    default:
+      return NAN;
+  }
+}
+
 }  // namespace wavin_sentio
 }  // namespace esphome
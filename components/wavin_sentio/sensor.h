@@ -13,17 +13,29 @@ enum SensorType : uint8_t {
   FLOOR_TEMPERATURE = 2,
   COMFORT_SETPOINT = 3,
   HUMIDITY = 4,
+  // Controller diagnostics, no channel, published once per throughput window
+  THROUGHPUT = 5,
+  TRANSACTIONS_OK = 6,
+  TRANSACTIONS_FAILED = 7,
+  LOOP_BUDGET_OVERRUNS = 8,
+  LOOP_BUDGET_EXHAUSTED = 9,
+  LOOP_MAX_RUN = 10,
 };
 
-class WavinSentioSensor : public sensor::Sensor, public Component {
+class WavinSentioSensor : public sensor::Sensor, public Component, public WavinSentioEntity {
  public:
   WavinSentioSensor() = default;
 
   void setup() override;
-  void loop() override;
   void dump_config() override;
   void update();
 
+  // Published by the parent when the channel has new data
+  void publish_from_parent() override { this->update(); }
+  uint32_t get_channel_mask() const override {
+    return this->is_diagnostic() ? DIAGNOSTICS_MASK : 1UL << this->channel_;
+  }
+
   float get_setup_priority() const override { return setup_priority::DATA; }
 
   // Configuration methods
@@ -34,8 +46,11 @@ class WavinSentioSensor : public sensor::Sensor, public Component {
   // Getters
   uint8_t get_channel() const { return this->channel_; }
   SensorType get_sensor_type() const { return this->sensor_type_; }
+  bool is_diagnostic() const { return this->sensor_type_ >= SensorType::THROUGHPUT; }
 
  protected:
+  float get_diagnostic_value() const;
+
   WavinSentio *parent_{nullptr};
   uint8_t channel_{0};
   SensorType sensor_type_{SensorType::TEMPERATURE};
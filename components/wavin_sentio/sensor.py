@@ -7,9 +7,15 @@ from esphome.const import (
     CONF_NAME,
     CONF_TYPE,
     CONF_CHANNEL,
+    CONF_ENTITY_CATEGORY,
+    CONF_STATE_CLASS,
+    CONF_UNIT_OF_MEASUREMENT,
     DEVICE_CLASS_BATTERY,
     DEVICE_CLASS_TEMPERATURE,
+    ENTITY_CATEGORY_DIAGNOSTIC,
     STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MICROSECOND,
     UNIT_PERCENT,
     UNIT_CELSIUS,
 )
@@ -25,19 +31,40 @@ CONF_SENSOR_TYPE_COMFORT_SETPOINT = "comfort_setpoint"
 WavinSentioSensor = wavin_sentio_ns.class_("WavinSentioSensor", sensor.Sensor, cg.Component)
 SensorType = wavin_sentio_ns.enum("SensorType")
 
-CONFIG_SCHEMA = sensor.sensor_schema(
+# Controller diagnostics, no channel: type: (enum value, unit, state class)
+DIAGNOSTIC_TYPES = {
+    "throughput": (SensorType.THROUGHPUT, "transactions/s", STATE_CLASS_MEASUREMENT),
+    "transactions_ok": (SensorType.TRANSACTIONS_OK, None, STATE_CLASS_TOTAL_INCREASING),
+    "transactions_failed": (SensorType.TRANSACTIONS_FAILED, None, STATE_CLASS_TOTAL_INCREASING),
+    "loop_budget_overruns": (SensorType.LOOP_BUDGET_OVERRUNS, None, STATE_CLASS_TOTAL_INCREASING),
+    "loop_budget_exhausted": (SensorType.LOOP_BUDGET_EXHAUSTED, None, STATE_CLASS_TOTAL_INCREASING),
+    "loop_max_run": (SensorType.LOOP_MAX_RUN, UNIT_MICROSECOND, STATE_CLASS_MEASUREMENT),
+}
+
+
+def validate_channel(config):
+    if config[CONF_TYPE] in DIAGNOSTIC_TYPES:
+        if CONF_CHANNEL in config:
+            raise cv.Invalid(f"'{CONF_CHANNEL}' is not used by the '{config[CONF_TYPE]}' sensor")
+    elif CONF_CHANNEL not in config:
+        raise cv.Invalid(f"'{CONF_CHANNEL}' is required for the '{config[CONF_TYPE]}' sensor")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(sensor.sensor_schema(
     WavinSentioSensor,
     accuracy_decimals=1,
 ).extend({
     cv.GenerateID(CONF_WAVIN_SENTIO_ID): cv.use_id(WavinSentio),
-    cv.Required(CONF_CHANNEL): cv.int_range(min=1, max=16),
+    cv.Optional(CONF_CHANNEL): cv.int_range(min=1, max=16),
     cv.Required(CONF_TYPE): cv.enum({
         CONF_SENSOR_TYPE_BATTERY: CONF_SENSOR_TYPE_BATTERY,
         CONF_SENSOR_TYPE_TEMPERATURE: CONF_SENSOR_TYPE_TEMPERATURE,
         CONF_SENSOR_TYPE_FLOOR_TEMPERATURE: CONF_SENSOR_TYPE_FLOOR_TEMPERATURE,
         CONF_SENSOR_TYPE_COMFORT_SETPOINT: CONF_SENSOR_TYPE_COMFORT_SETPOINT,
+        **{key: key for key in DIAGNOSTIC_TYPES},
     }),
-}).extend(cv.COMPONENT_SCHEMA)
+}).extend(cv.COMPONENT_SCHEMA), validate_channel)
 
 
 async def to_code(config):
@@ -47,10 +74,22 @@ async def to_code(config):
     
     parent = await cg.get_variable(config[CONF_WAVIN_SENTIO_ID])
     cg.add(var.set_parent(parent))
-    cg.add(var.set_channel(config[CONF_CHANNEL]))
     
     sensor_type = config[CONF_TYPE]
     
+    if sensor_type in DIAGNOSTIC_TYPES:
+        sensor_enum, unit, state_class = DIAGNOSTIC_TYPES[sensor_type]
+        cg.add(var.set_sensor_type(sensor_enum))
+        if unit is not None and not config.get(CONF_UNIT_OF_MEASUREMENT):
+            cg.add(var.set_unit_of_measurement(unit))
+        if not config.get(CONF_STATE_CLASS):
+            cg.add(var.set_state_class(sensor.STATE_CLASSES[state_class]))
+        if CONF_ENTITY_CATEGORY not in config:
+            cg.add(var.set_entity_category(cv.ENTITY_CATEGORIES[ENTITY_CATEGORY_DIAGNOSTIC]))
+        return
+    
+    cg.add(var.set_channel(config[CONF_CHANNEL]))
+    
     if sensor_type == CONF_SENSOR_TYPE_BATTERY:
         cg.add(var.set_sensor_type(SensorType.BATTERY))
         if not config.get(sensor.CONF_UNIT_OF_MEASUREMENT):
@@ -0,0 +1,51 @@
+#include "trace.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace wavin_sentio {
+
+// Serialized record: timestamp (u32 LE), channel, offset, event, value (u16 LE)
+static const size_t RECORD_BYTES = 9;
+static const size_t RECORDS_PER_LINE = 8;
+static const uint8_t TRACE_FORMAT_VERSION = 1;
+
+void TraceBuffer::dump(const char *tag, uint8_t address) const {
+  static const char *const HEX = "0123456789abcdef";
+
+  ESP_LOGI(tag, "SENTIO-TRACE BEGIN v%u address=0x%02X records=%u",
+           TRACE_FORMAT_VERSION, address, this->count_);
+
+  size_t start = (this->head_ + WAVIN_SENTIO_TRACE_SIZE - this->count_) % WAVIN_SENTIO_TRACE_SIZE;
+  char line[RECORDS_PER_LINE * RECORD_BYTES * 2 + 1];
+  size_t pos = 0;
+
+  for (size_t i = 0; i < this->count_; i++) {
+    const TraceRecord &record = this->records_[(start + i) % WAVIN_SENTIO_TRACE_SIZE];
+    const uint8_t bytes[RECORD_BYTES] = {
+        static_cast<uint8_t>(record.timestamp),
+        static_cast<uint8_t>(record.timestamp >> 8),
+        static_cast<uint8_t>(record.timestamp >> 16),
+        static_cast<uint8_t>(record.timestamp >> 24),
+        record.channel,
+        record.offset,
+        record.event,
+        static_cast<uint8_t>(record.value),
+        static_cast<uint8_t>(record.value >> 8),
+    };
+    for (uint8_t byte : bytes) {
+      line[pos++] = HEX[byte >> 4];
+      line[pos++] = HEX[byte & 0x0F];
+    }
+
+    if ((i + 1) % RECORDS_PER_LINE == 0 || i + 1 == this->count_) {
+      line[pos] = '\0';
+      ESP_LOGI(tag, "SENTIO-TRACE %s", line);
+      pos = 0;
+    }
+  }
+
+  ESP_LOGI(tag, "SENTIO-TRACE END");
+}
+
+}  // namespace wavin_sentio
+}  // namespace esphome
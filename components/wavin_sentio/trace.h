@@ -0,0 +1,68 @@
+#pragma once
+
+#include "esphome/core/hal.h"
+#include <cstdint>
+
+#ifndef WAVIN_SENTIO_TRACE_SIZE
+#define WAVIN_SENTIO_TRACE_SIZE 128
+#endif
+
+namespace esphome {
+namespace wavin_sentio {
+
+// Events recorded in the binary trace, values must stay in sync with tools/decode_trace.py
+enum TraceEvent : uint8_t {
+  TRACE_READ_SENT = 1,       // value: attempt
+  TRACE_WRITE_SENT = 2,      // value: payload
+  TRACE_RESPONSE = 3,        // value: register value
+  TRACE_TIMEOUT = 4,         // value: attempt
+  TRACE_EXCEPTION = 5,       // value: exception code
+  TRACE_SHORT_RESPONSE = 6,  // value: response length
+  TRACE_REJECTED = 7,        // value: raw value outside the sanity window
+  TRACE_DISCOVERED = 8,      // value: raw air temperature
+  TRACE_SYSTEM_CHANGE = 9,   // value: system mode, bit 15 set while globally blocked
+  TRACE_MALFORMED = 10,      // value: ResponseCheck << 8 | response length
+};
+
+struct TraceRecord {
+  uint32_t timestamp;  // micros()
+  uint8_t channel;
+  uint8_t offset;
+  uint8_t event;
+  uint16_t value;
+};
+
+// Fixed-size ring of register events. Recording is a couple of stores, so it can
+// stay enabled in the hot path where formatted logging would distort bus timing.
+class TraceBuffer {
+ public:
+  void record(TraceEvent event, uint8_t channel, uint8_t offset, uint16_t value) {
+    TraceRecord &record = this->records_[this->head_];
+    record.timestamp = micros();
+    record.channel = channel;
+    record.offset = offset;
+    record.event = event;
+    record.value = value;
+    this->head_ = (this->head_ + 1) % WAVIN_SENTIO_TRACE_SIZE;
+    if (this->count_ < WAVIN_SENTIO_TRACE_SIZE) {
+      this->count_++;
+    }
+  }
+
+  // Logs the ring oldest-first as hex lines for tools/decode_trace.py
+  void dump(const char *tag, uint8_t address) const;
+  void clear() {
+    this->head_ = 0;
+    this->count_ = 0;
+  }
+
+  size_t size() const { return this->count_; }
+
+ protected:
+  TraceRecord records_[WAVIN_SENTIO_TRACE_SIZE];
+  size_t head_{0};
+  size_t count_{0};
+};
+
+}  // namespace wavin_sentio
+}  // namespace esphome
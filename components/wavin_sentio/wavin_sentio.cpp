@@ -6,7 +6,14 @@ namespace esphome {
 namespace wavin_sentio {
 
 static const char *const TAG = "wavin_sentio";
-static const uint8_t MAX_RETRIES = 3;
+
+// Modbus function codes
+static const uint8_t FUNCTION_READ_HOLDING_REGISTERS = 0x03;
+static const uint8_t FUNCTION_READ_INPUT_REGISTERS = 0x04;
+static const uint8_t FUNCTION_WRITE_SINGLE_REGISTER = 0x06;
+
+// Window over which per-controller throughput is averaged
+static const uint32_t THROUGHPUT_WINDOW_MS = 60000;
 
 // Register offsets within each channel's 100-block
 static const uint8_t REG_DESIRED_TEMP = 1;      // X01 - Desired temperature
@@ -17,6 +24,23 @@ static const uint8_t REG_FLOOR_TEMP = 5;        // X05 - Floor temperature (×10
 static const uint8_t REG_HUMIDITY = 6;          // X06 - Relative humidity (×100)
 static const uint8_t REG_SETPOINT = 19;         // X19 - Temperature setpoint (×100)
 
+// X01-X06 are input registers, everything from X19 on is a holding register
+static bool is_input_register(uint8_t offset) { return offset >= REG_DESIRED_TEMP && offset <= REG_HUMIDITY; }
+
+// Air and floor temperature are adjacent, so one read both discovers a
+// channel and detects its floor sensor
+static const uint8_t DISCOVERY_BLOCK_SIZE = 2;  // X04-X05
+static const uint8_t MEASUREMENT_BLOCK_SIZE = 3;  // X04-X06
+
+// Controller-wide registers live in the channel 0 block. This map is assumed, it is
+// not part of the documented Sentio register map - polling stops if it is rejected.
+static const uint8_t SYSTEM_CHANNEL = 0;
+static const uint8_t REG_SYS_OUTDOOR_TEMP = 1;  // 001 - Outdoor temperature (×100, signed)
+static const uint8_t REG_SYS_MODE = 2;          // 002 - System mode (1 = heating, 2 = cooling)
+static const uint8_t REG_SYS_BLOCKING = 3;      // 003 - Global blocking state (0 = not blocked)
+static const uint8_t REG_SYS_FIRMWARE = 4;      // 004 - Firmware version (major << 8 | minor)
+static const uint8_t SYSTEM_BLOCK_SIZE = 4;
+
 void WavinSentio::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Wavin Sentio...");
   
@@ -25,15 +49,44 @@ void WavinSentio::setup() {
     this->channels_[i] = ChannelData(i);
   }
   
-  // Start discovery process
   this->current_poll_channel_ = 1;
+  
+  // Join the arbiter shared by all controllers on this modbus
+  this->bus_ = WavinSentioBus::get_for(this->parent_);
+  this->bus_->register_controller(this);
+  this->window_start_ = millis();
+  
+  // Probe all channels back-to-back before normal scheduling starts
+  this->discover_channels();
+  
+  // Work done in loop(), interleaved within the loop budget
+  this->executor_.add_task("bus", [this]() {
+    // Drive the shared bus - hands out the next request and handles timeouts
+    this->bus_->service();
+    return false;
+  });
+  this->executor_.add_task("decode", [this]() { return this->decode_step(); });
+  this->executor_.add_task("publish", [this]() { return this->publish_step(); });
+  
+  // Controller-wide registers at a lower cadence, first read right away
+  if (this->system_registers_) {
+    this->poll_system();
+    this->set_interval("system", this->system_update_interval_, [this]() { this->poll_system(); });
+  }
 }
 
 void WavinSentio::loop() {
-  // Handle any ongoing modbus operations
+  this->executor_.run();
 }
 
 void WavinSentio::update() {
+  this->update_throughput();
+  
+  // Normal scheduling starts once the discovery burst has completed
+  if (this->is_discovering()) {
+    return;
+  }
+  
   // Poll configured number of channels per update cycle
   for (uint8_t i = 0; i < this->poll_channels_per_cycle_; i++) {
     if (this->current_poll_channel_ > 16) {
@@ -49,6 +102,26 @@ void WavinSentio::dump_config() {
   ESP_LOGCONFIG(TAG, "Wavin Sentio:");
   ESP_LOGCONFIG(TAG, "  Update Interval: %u ms", this->get_update_interval());
   ESP_LOGCONFIG(TAG, "  Poll Channels Per Cycle: %u", this->poll_channels_per_cycle_);
+  ESP_LOGCONFIG(TAG, "  Response Timeout: %u ms", this->response_timeout_);
+  ESP_LOGCONFIG(TAG, "  Discovery Timeout: %u ms", this->discovery_timeout_);
+  ESP_LOGCONFIG(TAG, "  Max Retries: %u", this->max_retries_);
+  ESP_LOGCONFIG(TAG, "  Deadband: %.2f°C, %.1f%%", this->temperature_deadband_, this->humidity_deadband_);
+  ESP_LOGCONFIG(TAG, "  System Update Interval: %u ms", this->system_update_interval_);
+  if (!this->system_registers_) {
+    ESP_LOGCONFIG(TAG, "  System Registers: disabled");
+  } else if (!this->system_supported_) {
+    ESP_LOGCONFIG(TAG, "  System Registers: not supported by controller");
+  } else if (this->system_.valid) {
+    ESP_LOGCONFIG(TAG, "  Firmware Version: %u.%u", 
+                  this->system_.firmware_version >> 8, this->system_.firmware_version & 0xFF);
+    ESP_LOGCONFIG(TAG, "  System Mode: %u%s", this->system_.mode, this->system_.blocked ? " (blocked)" : "");
+  }
+  if (this->bus_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Controllers On Bus: %u", this->bus_->get_controller_count());
+  }
+  ESP_LOGCONFIG(TAG, "  Throughput: %.2f transactions/s (%u ok, %u failed)", 
+                this->throughput_, this->transactions_ok_, this->transactions_failed_);
+  this->executor_.dump_config(TAG);
   
   if (this->flow_control_pin_.has_value()) {
     ESP_LOGCONFIG(TAG, "  Flow Control Pin: GPIO%u", this->flow_control_pin_.value());
@@ -72,6 +145,100 @@ void WavinSentio::dump_config() {
   ESP_LOGCONFIG(TAG, "  Discovered Channels: %u", discovered_count);
 }
 
+bool WavinSentio::set_tuning(TuningParameter parameter, float value) {
+  if (std::isnan(value)) {
+    return false;
+  }
+  
+  switch (parameter) {
+    case TUNING_UPDATE_INTERVAL:
+      if (value < 1.0f || value > 3600.0f) {
+        return false;
+      }
+      // Restart the poller so the new interval applies from the next tick,
+      // values restored before setup() are picked up when the poller starts
+      this->set_update_interval(static_cast<uint32_t>(value * 1000.0f));
+      if (this->is_ready()) {
+        this->stop_poller();
+        this->start_poller();
+      }
+      break;
+    
+    case TUNING_SYSTEM_UPDATE_INTERVAL:
+      if (value < 10.0f || value > 3600.0f) {
+        return false;
+      }
+      this->system_update_interval_ = static_cast<uint32_t>(value * 1000.0f);
+      if (this->is_ready() && this->system_registers_ && this->system_supported_) {
+        // Replaces the interval registered in setup() by name
+        this->set_interval("system", this->system_update_interval_, [this]() { this->poll_system(); });
+      }
+      break;
+    
+    case TUNING_POLL_CHANNELS_PER_CYCLE:
+      if (value < 1.0f || value > 16.0f) {
+        return false;
+      }
+      this->poll_channels_per_cycle_ = static_cast<uint8_t>(value);
+      break;
+    
+    case TUNING_RESPONSE_TIMEOUT:
+      if (value < 50.0f || value > 2000.0f) {
+        return false;
+      }
+      this->response_timeout_ = static_cast<uint32_t>(value);
+      break;
+    
+    case TUNING_MAX_RETRIES:
+      if (value < 0.0f || value > 5.0f) {
+        return false;
+      }
+      this->max_retries_ = static_cast<uint8_t>(value);
+      break;
+    
+    case TUNING_TEMPERATURE_DEADBAND:
+      if (value < 0.0f || value > 5.0f) {
+        return false;
+      }
+      this->temperature_deadband_ = value;
+      break;
+    
+    case TUNING_HUMIDITY_DEADBAND:
+      if (value < 0.0f || value > 20.0f) {
+        return false;
+      }
+      this->humidity_deadband_ = value;
+      break;
+    
+    default:
+      return false;
+  }
+  
+  ESP_LOGD(TAG, "Tuning parameter %u set to %.2f", parameter, value);
+  return true;
+}
+
+float WavinSentio::get_tuning(TuningParameter parameter) const {
+  switch (parameter) {
+    case TUNING_UPDATE_INTERVAL:
+      return this->get_update_interval() / 1000.0f;
+    case TUNING_SYSTEM_UPDATE_INTERVAL:
+      return this->system_update_interval_ / 1000.0f;
+    case TUNING_POLL_CHANNELS_PER_CYCLE:
+      return this->poll_channels_per_cycle_;
+    case TUNING_RESPONSE_TIMEOUT:
+      return this->response_timeout_;
+    case TUNING_MAX_RETRIES:
+      return this->max_retries_;
+    case TUNING_TEMPERATURE_DEADBAND:
+      return this->temperature_deadband_;
+    case TUNING_HUMIDITY_DEADBAND:
+      return this->humidity_deadband_;
+    default:
+      return NAN;
+  }
+}
+
 void WavinSentio::set_channel_friendly_name(uint8_t channel, const std::string &name) {
   if (channel >= 1 && channel <= 16) {
     this->friendly_names_[channel] = name;
@@ -99,68 +266,169 @@ uint16_t WavinSentio::get_register_address(uint8_t channel, uint8_t offset) {
   return (channel * 100) + offset;
 }
 
-bool WavinSentio::read_register(uint8_t channel, uint8_t offset, uint16_t &value) {
-  uint16_t address = this->get_register_address(channel, offset);
-  
-  // Try to read with retry logic
-  for (uint8_t attempt = 0; attempt < MAX_RETRIES; attempt++) {
-    ESP_LOGD(TAG, "Reading channel %u register %u (0x%04X), attempt %u/%u", 
-             channel, offset, address, attempt + 1, MAX_RETRIES);
-    
-    // TODO: Implement actual Modbus communication using ModbusDevice base class
-    // For now, provide a working placeholder that compiles
-    
-    // Simulate reading different values based on register type
-    switch (offset) {
-      case REG_AIR_TEMP:        // Air temperature
-        value = 2200;  // 22.00°C (×100)
-        break;
-      case REG_FLOOR_TEMP:      // Floor temperature  
-        value = 2150;  // 21.50°C (×100)
-        break;
-      case REG_HUMIDITY:        // Humidity
-        value = 4500;  // 45.00% (×100)
-        break;
-      case REG_SETPOINT:        // Setpoint
-        value = 2100;  // 21.00°C (×100)
-        break;
-      case REG_MODE:            // Mode
-        value = 1;     // Some mode value
-        break;
-      default:
-        value = 0;     // Default for unknown registers
-        break;
+bool WavinSentio::read_register(uint8_t channel, uint8_t offset, uint8_t count) {
+  // Skip if the same register is already waiting for the bus
+  for (const auto &tx : this->queue_) {
+    if (!tx.is_write && tx.channel == channel && tx.offset == offset && tx.count == count) {
+      return true;
     }
-    
-    ESP_LOGD(TAG, "Read value %u from channel %u register %u (placeholder)", 
-             value, channel, offset);
-    return true;  // Always succeed for now
   }
   
-  ESP_LOGW(TAG, "Failed to read channel %u register %u (0x%04X) after %u attempts", 
-           channel, offset, address, MAX_RETRIES);
-  return false;
+  if (this->queue_.size() >= MAX_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Queue full, dropping read of channel %u register %u", channel, offset);
+    return false;
+  }
+  
+  Transaction tx;
+  tx.channel = channel;
+  tx.offset = offset;
+  tx.count = count;
+  tx.input = is_input_register(offset);
+  tx.deadline = millis() + this->get_update_interval();
+  this->queue_.push_back(tx);
+  return true;
 }
 
 bool WavinSentio::write_register(uint8_t channel, uint8_t offset, uint16_t value) {
-  uint16_t address = this->get_register_address(channel, offset);
+  // Coalesce with a pending write to the same register - only the latest value matters
+  for (auto &tx : this->queue_) {
+    if (tx.is_write && tx.channel == channel && tx.offset == offset) {
+      tx.value = value;
+      tx.attempts = 0;
+      return true;
+    }
+  }
   
-  // Try to write with retry logic
-  for (uint8_t attempt = 0; attempt < MAX_RETRIES; attempt++) {
-    ESP_LOGD(TAG, "Writing %u to channel %u register %u (0x%04X), attempt %u/%u", 
-             value, channel, offset, address, attempt + 1, MAX_RETRIES);
-    
-    // TODO: Implement actual Modbus communication using ModbusDevice base class
-    // For now, provide a working placeholder that compiles
-    
-    ESP_LOGD(TAG, "Successfully wrote %u to channel %u register %u (0x%04X) (placeholder)", 
-             value, channel, offset, address);
-    return true;  // Always succeed for now
+  if (this->queue_.size() >= MAX_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Queue full, dropping write of %u to channel %u register %u", value, channel, offset);
+    return false;
+  }
+  
+  Transaction tx;
+  tx.channel = channel;
+  tx.offset = offset;
+  tx.value = value;
+  tx.is_write = true;
+  tx.deadline = millis();
+  this->queue_.push_back(tx);
+  return true;
+}
+
+int WavinSentio::find_next_transaction() const {
+  // Writes first, then earliest deadline
+  int best = -1;
+  for (size_t i = 0; i < this->queue_.size(); i++) {
+    const Transaction &tx = this->queue_[i];
+    if (best < 0) {
+      best = static_cast<int>(i);
+      continue;
+    }
+    const Transaction &current = this->queue_[best];
+    if (tx.is_write != current.is_write) {
+      if (tx.is_write) {
+        best = static_cast<int>(i);
+      }
+    } else if (static_cast<int32_t>(tx.deadline - current.deadline) < 0) {
+      best = static_cast<int>(i);
+    }
+  }
+  return best;
+}
+
+const Transaction *WavinSentio::peek_transaction() const {
+  if (this->has_in_flight_) {
+    return nullptr;
+  }
+  int index = this->find_next_transaction();
+  if (index < 0) {
+    return nullptr;
+  }
+  return &this->queue_[index];
+}
+
+bool WavinSentio::dispatch_transaction() {
+  int index = this->find_next_transaction();
+  if (index < 0 || this->has_in_flight_) {
+    return false;
+  }
+  
+  this->in_flight_ = this->queue_[index];
+  this->queue_.erase(this->queue_.begin() + index);
+  this->in_flight_.attempts++;
+  this->has_in_flight_ = true;
+  
+  uint16_t address = this->get_register_address(this->in_flight_.channel, this->in_flight_.offset);
+  
+  if (this->in_flight_.is_write) {
+    this->trace_.record(TRACE_WRITE_SENT, this->in_flight_.channel, this->in_flight_.offset, this->in_flight_.value);
+    SENTIO_HOT_LOGD(TAG, "Writing %u to channel %u register %u (0x%04X), attempt %u/%u", 
+             this->in_flight_.value, this->in_flight_.channel, this->in_flight_.offset, address,
+             this->in_flight_.attempts, this->max_retries_ + 1);
+    uint8_t payload[2] = {static_cast<uint8_t>(this->in_flight_.value >> 8),
+                          static_cast<uint8_t>(this->in_flight_.value & 0xFF)};
+    this->send(FUNCTION_WRITE_SINGLE_REGISTER, address, 1, sizeof(payload), payload);
+  } else {
+    this->trace_.record(TRACE_READ_SENT, this->in_flight_.channel, this->in_flight_.offset, this->in_flight_.attempts);
+    SENTIO_HOT_LOGD(TAG, "Reading channel %u register %u (0x%04X), attempt %u/%u", 
+             this->in_flight_.channel, this->in_flight_.offset, address,
+             this->in_flight_.attempts, this->max_retries_ + 1);
+    this->send(this->in_flight_.input ? FUNCTION_READ_INPUT_REGISTERS : FUNCTION_READ_HOLDING_REGISTERS,
+               address, this->in_flight_.count);
+  }
+  return true;
+}
+
+void WavinSentio::on_transaction_timeout() {
+  if (!this->has_in_flight_) {
+    return;
+  }
+  this->has_in_flight_ = false;
+  
+  Transaction tx = this->in_flight_;
+  this->trace_.record(TRACE_TIMEOUT, tx.channel, tx.offset, tx.attempts);
+  
+  // A missing thermostat is expected during discovery, the normal rotation picks up stragglers
+  if (tx.probe) {
+    this->finish_probe();
+    return;
+  }
+  
+  if (tx.attempts <= this->max_retries_) {
+    // Keep the original deadline so the retry goes out ahead of newer requests
+    this->queue_.push_front(tx);
+    return;
+  }
+  
+  this->transactions_failed_++;
+  uint16_t address = this->get_register_address(tx.channel, tx.offset);
+  if (tx.is_write) {
+    ESP_LOGW(TAG, "Failed to write to channel %u register %u (0x%04X) after %u attempts", 
+             tx.channel, tx.offset, address, tx.attempts);
+    this->write_failed_callback_.call(tx.channel, tx.offset);
+  } else {
+    ESP_LOGW(TAG, "Failed to read channel %u register %u (0x%04X) after %u attempts", 
+             tx.channel, tx.offset, address, tx.attempts);
+  }
+}
+
+void WavinSentio::update_throughput() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - this->window_start_;
+  if (elapsed < THROUGHPUT_WINDOW_MS) {
+    return;
   }
   
-  ESP_LOGW(TAG, "Failed to write to channel %u register %u (0x%04X) after %u attempts", 
-           channel, offset, address, MAX_RETRIES);
-  return false;
+  this->throughput_ = this->window_ok_ * 1000.0f / elapsed;
+  this->window_ok_ = 0;
+  this->window_start_ = now;
+  
+  ESP_LOGD(TAG, "Controller 0x%02X throughput: %.2f transactions/s (%u ok, %u failed, %u queued)",
+           this->address_, this->throughput_, this->transactions_ok_, this->transactions_failed_,
+           this->queue_.size());
+  ESP_LOGD(TAG, "Controller 0x%02X loop budget: max run %u us, %u overruns, %u exhausted",
+           this->address_, this->executor_.get_max_run_us(), this->executor_.get_overruns(),
+           this->executor_.get_exhausted());
+  this->dirty_channels_ |= DIAGNOSTICS_MASK;
 }
 
 void WavinSentio::poll_channel(uint8_t channel) {
@@ -168,106 +436,374 @@ void WavinSentio::poll_channel(uint8_t channel) {
     return;
   }
   
-  ChannelData *data = &this->channels_[channel];
-  uint16_t raw_value;
-  bool read_success = false;
+  // Air temperature indicates if the channel exists, the remaining
+  // registers are only worth reading once it has been discovered
+  if (!this->channels_[channel].discovered) {
+    this->read_register(channel, REG_AIR_TEMP, DISCOVERY_BLOCK_SIZE);
+    return;
+  }
   
-  // Try to read air temperature first - this indicates if channel exists
-  if (this->read_register(channel, REG_AIR_TEMP, raw_value)) {
-    read_success = true;
+  this->read_register(channel, REG_AIR_TEMP, MEASUREMENT_BLOCK_SIZE);
+  this->read_register(channel, REG_SETPOINT);
+  // Zone modes are meaningless while the whole system is blocked
+  if (!this->is_system_blocked()) {
+    this->read_register(channel, REG_MODE);
+  }
+}
+
+void WavinSentio::poll_system() {
+  if (!this->system_registers_ || !this->system_supported_) {
+    return;
+  }
+  this->read_register(SYSTEM_CHANNEL, REG_SYS_OUTDOOR_TEMP, SYSTEM_BLOCK_SIZE);
+}
+
+void WavinSentio::handle_system_value(uint8_t offset, uint16_t raw_value) {
+  // Values are collected into pending_system_ and committed once the whole block is decoded
+  switch (offset) {
+    case REG_SYS_OUTDOOR_TEMP:
+      // NAN when no outdoor sensor is connected
+      this->pending_system_.outdoor_temperature = decode_outdoor_temperature(raw_value);
+      break;
     
-    // Temperature is stored as value * 100, so divide by 100
-    float temperature = raw_value / 100.0f;
+    case REG_SYS_MODE:
+      this->pending_system_.mode = raw_value;
+      break;
     
-    // Sanity check - temperature should be reasonable (5-40°C typically)
-    if (temperature > 5.0f && temperature < 50.0f) {
-      data->current_temperature = temperature;
-      data->discovered = true;
-      
-      // Set friendly name if configured
-      if (this->friendly_names_.find(channel) != this->friendly_names_.end()) {
-        data->friendly_name = this->friendly_names_[channel];
-      } else {
-        data->friendly_name = "Zone " + std::to_string(channel);
+    case REG_SYS_BLOCKING:
+      this->pending_system_.blocked = raw_value != 0;
+      break;
+    
+    case REG_SYS_FIRMWARE:
+      this->pending_system_.firmware_version = raw_value;
+      break;
+    
+    default:
+      break;
+  }
+  
+  if (offset != REG_SYS_OUTDOOR_TEMP + SYSTEM_BLOCK_SIZE - 1) {
+    return;
+  }
+  
+  // Whole block decoded - compare and commit
+  SystemData previous = this->system_;
+  this->system_ = this->pending_system_;
+  this->system_.valid = true;
+  
+  if (!previous.valid) {
+    ESP_LOGI(TAG, "Controller firmware version %u.%u", 
+             this->system_.firmware_version >> 8, this->system_.firmware_version & 0xFF);
+  }
+  
+  if (previous.valid && previous.mode == this->system_.mode && previous.blocked == this->system_.blocked) {
+    return;
+  }
+  
+  ESP_LOGI(TAG, "System mode %u%s", this->system_.mode, this->system_.blocked ? ", globally blocked" : "");
+  this->trace_.record(TRACE_SYSTEM_CHANGE, SYSTEM_CHANNEL, REG_SYS_MODE,
+                      this->system_.mode | (this->system_.blocked ? 0x8000 : 0));
+  
+  // One event for all zones instead of each of them discovering the change
+  this->dirty_channels_ |= 0x1FFFEUL;
+  this->system_callback_.call(this->system_);
+  
+  // Zone modes were not polled while blocked, refresh them now
+  if (previous.blocked && !this->system_.blocked) {
+    for (const auto &pair : this->channels_) {
+      if (pair.second.discovered) {
+        this->read_register(pair.first, REG_MODE);
       }
-      
-      ESP_LOGV(TAG, "Channel %u air temp: %.1f°C", channel, temperature);
     }
   }
+}
+
+void WavinSentio::handle_register_value(uint8_t channel, uint8_t offset, uint16_t raw_value) {
+  if (channel == SYSTEM_CHANNEL) {
+    this->handle_system_value(offset, raw_value);
+    return;
+  }
+  
+  if (channel < 1 || channel > 16) {
+    return;
+  }
   
-  // If channel exists, read other registers
-  if (data->discovered) {
-    // Read floor temperature
-    if (this->read_register(channel, REG_FLOOR_TEMP, raw_value)) {
-      float floor_temp = raw_value / 100.0f;
+  ChannelData *data = &this->channels_[channel];
+  this->dirty_channels_ |= 1UL << channel;
+  
+  switch (offset) {
+    case REG_AIR_TEMP: {
+      float temperature = decode_air_temperature(raw_value);
+      if (!std::isnan(temperature)) {
+        data->current_temperature = temperature;
+        
+        if (!data->discovered) {
+          data->discovered = true;
+          
+          // Set friendly name if configured
+          if (this->friendly_names_.find(channel) != this->friendly_names_.end()) {
+            data->friendly_name = this->friendly_names_[channel];
+          } else {
+            data->friendly_name = "Zone " + std::to_string(channel);
+          }
+          
+          // TODO: Read battery level if available
+          // This may require reading from a different register or calculation
+          // For now, set to a default value
+          data->battery_level = 100.0f;  // Placeholder
+          
+          this->trace_.record(TRACE_DISCOVERED, channel, offset, raw_value);
+          ESP_LOGI(TAG, "Discovered channel %u", channel);
+          
+          // Fetch the remaining registers without waiting for the next rotation,
+          // floor temperature arrives in the same block as the air temperature
+          this->read_register(channel, REG_HUMIDITY);
+          this->read_register(channel, REG_SETPOINT);
+          if (!this->is_system_blocked()) {
+            this->read_register(channel, REG_MODE);
+          }
+        }
+        
+        SENTIO_HOT_LOGV(TAG, "Channel %u air temp: %.1f°C", channel, temperature);
+      } else {
+        this->trace_.record(TRACE_REJECTED, channel, offset, raw_value);
+      }
+      break;
+    }
+    
+    case REG_FLOOR_TEMP: {
+      float floor_temp = decode_floor_temperature(raw_value);
       
-      // Floor sensor detection: valid readings are > 1°C and < 90°C
-      if (floor_temp > 1.0f && floor_temp < 90.0f) {
+      // Floor sensor is present when the reading is plausible
+      if (!std::isnan(floor_temp)) {
         data->floor_temperature = floor_temp;
         data->has_floor_sensor = true;
-        ESP_LOGV(TAG, "Channel %u floor temp: %.1f°C", channel, floor_temp);
+        SENTIO_HOT_LOGV(TAG, "Channel %u floor temp: %.1f°C", channel, floor_temp);
       } else {
         data->floor_temperature = NAN;
         data->has_floor_sensor = false;
       }
+      break;
     }
     
-    // Read humidity
-    if (this->read_register(channel, REG_HUMIDITY, raw_value)) {
-      float humidity = raw_value / 100.0f;
-      if (humidity >= 0.0f && humidity <= 100.0f) {
+    case REG_HUMIDITY: {
+      float humidity = decode_humidity(raw_value);
+      if (!std::isnan(humidity)) {
         data->humidity = humidity;
-        ESP_LOGV(TAG, "Channel %u humidity: %.1f%%", channel, humidity);
+        SENTIO_HOT_LOGV(TAG, "Channel %u humidity: %.1f%%", channel, humidity);
+      } else {
+        this->trace_.record(TRACE_REJECTED, channel, offset, raw_value);
       }
+      break;
     }
     
-    // Read target temperature (setpoint)
-    if (this->read_register(channel, REG_SETPOINT, raw_value)) {
-      float setpoint = raw_value / 100.0f;
-      if (setpoint > 5.0f && setpoint < 35.0f) {
+    case REG_SETPOINT: {
+      float setpoint = decode_setpoint(raw_value);
+      if (!std::isnan(setpoint)) {
         data->target_temperature = setpoint;
-        ESP_LOGV(TAG, "Channel %u setpoint: %.1f°C", channel, setpoint);
+        data->setpoint_read_sequence = this->decode_sequence_;
+        SENTIO_HOT_LOGV(TAG, "Channel %u setpoint: %.1f°C", channel, setpoint);
+      } else {
+        this->trace_.record(TRACE_REJECTED, channel, offset, raw_value);
       }
+      break;
     }
     
-    // Read mode/state
-    if (this->read_register(channel, REG_MODE, raw_value)) {
+    case REG_MODE:
       data->mode = raw_value;
-      ESP_LOGV(TAG, "Channel %u mode: 0x%04X", channel, raw_value);
-    }
+      SENTIO_HOT_LOGV(TAG, "Channel %u mode: 0x%04X", channel, raw_value);
+      break;
     
-    // TODO: Read battery level if available
-    // This may require reading from a different register or calculation
-    // For now, set to a default value
-    data->battery_level = 100.0f;  // Placeholder
-  } else if (read_success) {
-    // First time discovering this channel
-    ESP_LOGI(TAG, "Discovered channel %u", channel);
+    default:
+      break;
   }
 }
 
 void WavinSentio::discover_channels() {
-  // Discovery happens automatically during polling
-  // Channels that respond to temperature reads are marked as discovered
+  // Probe every channel back-to-back with a short timeout. Channels that respond
+  // with a valid air temperature are marked as discovered, anything missed here
+  // is still picked up by the normal polling rotation.
+  this->discovery_start_ = millis();
+  
+  for (uint8_t channel = 1; channel <= 16; channel++) {
+    Transaction tx;
+    tx.channel = channel;
+    tx.offset = REG_AIR_TEMP;
+    tx.count = DISCOVERY_BLOCK_SIZE;
+    tx.input = true;
+    tx.probe = true;
+    tx.deadline = this->discovery_start_;
+    this->queue_.push_back(tx);
+    this->discovery_remaining_++;
+  }
+  
+  ESP_LOGD(TAG, "Probing %u channels", this->discovery_remaining_);
+}
+
+void WavinSentio::finish_probe() {
+  if (this->discovery_remaining_ == 0 || --this->discovery_remaining_ > 0) {
+    return;
+  }
+  
+  uint8_t discovered_count = 0;
+  for (const auto &pair : this->channels_) {
+    if (pair.second.discovered) {
+      discovered_count++;
+    }
+  }
+  ESP_LOGI(TAG, "Discovery finished: %u channels in %u ms", discovered_count, millis() - this->discovery_start_);
+}
+
+void WavinSentio::register_entity(WavinSentioEntity *entity) {
+  this->entities_.push_back(entity);
 }
 
-void WavinSentio::register_climate(climate::Climate *climate_entity, uint8_t channel) {
-  ESP_LOGD(TAG, "Registering climate entity for channel %u", channel);
-  // Climate entities will pull data from channel_data during their update
+bool WavinSentio::decode_step() {
+  if (this->received_.empty()) {
+    return false;
+  }
+  
+  Transaction tx = this->received_.front();
+  this->received_.pop_front();
+  this->decode_sequence_++;
+  
+  // Write acks go through the same queue, so reads sent before the write are decoded first
+  if (tx.is_write) {
+    if (tx.offset == REG_SETPOINT && tx.channel >= 1 && tx.channel <= 16) {
+      this->channels_[tx.channel].setpoint_write_sequence = this->decode_sequence_;
+      this->dirty_channels_ |= 1UL << tx.channel;
+    }
+    return !this->received_.empty();
+  }
+  
+  this->handle_register_value(tx.channel, tx.offset, tx.value);
+  
+  // Probe is complete once the last register of its block is decoded
+  if (tx.probe && tx.offset == REG_AIR_TEMP + DISCOVERY_BLOCK_SIZE - 1) {
+    this->finish_probe();
+  }
+  return !this->received_.empty();
 }
 
-void WavinSentio::register_climate_group(climate::Climate *climate_entity, const std::vector<uint8_t> &members) {
-  ESP_LOGD(TAG, "Registering group climate entity with %u members", members.size());
-  // Group climate entities will aggregate data from multiple channels
+bool WavinSentio::publish_step() {
+  // Start a new sweep over all entities once channels have new data
+  if (this->publish_cursor_ == 0) {
+    if (this->dirty_channels_ == 0) {
+      return false;
+    }
+    this->publishing_channels_ = this->dirty_channels_;
+    this->dirty_channels_ = 0;
+  }
+  
+  if (this->publish_cursor_ < this->entities_.size()) {
+    WavinSentioEntity *entity = this->entities_[this->publish_cursor_++];
+    if (entity->get_channel_mask() & this->publishing_channels_) {
+      entity->publish_from_parent();
+    }
+  }
+  
+  if (this->publish_cursor_ >= this->entities_.size()) {
+    this->publish_cursor_ = 0;
+    return this->dirty_channels_ != 0;
+  }
+  return true;
 }
 
 void WavinSentio::on_modbus_data(const std::vector<uint8_t> &data) {
-  ESP_LOGV(TAG, "Received Modbus data: %u bytes", data.size());
-  // Handle incoming modbus data
-  // This is called when data is received from the modbus device
-  // For now, just log the data for debugging
-  for (size_t i = 0; i < data.size() && i < 16; i++) {
-    ESP_LOGV(TAG, "  [%u]: 0x%02X", i, data[i]);
+  SENTIO_HOT_LOGV(TAG, "Received Modbus data: %u bytes", data.size());
+  
+  if (!this->has_in_flight_) {
+    SENTIO_HOT_LOGV(TAG, "Ignoring unsolicited response");
+    return;
+  }
+  
+  Transaction tx = this->in_flight_;
+  this->has_in_flight_ = false;
+  this->bus_->release(this);
+  
+  // Read responses carry the register values, write responses echo address and value.
+  // Anything that does not match the request exactly is dropped rather than decoded.
+  uint16_t address = this->get_register_address(tx.channel, tx.offset);
+  ResponseCheck check = tx.is_write ? check_write_response(data.data(), data.size(), address, tx.value)
+                                    : check_read_response(data.data(), data.size(), tx.count);
+  if (check != RESPONSE_OK) {
+    if (check == RESPONSE_SHORT) {
+      this->trace_.record(TRACE_SHORT_RESPONSE, tx.channel, tx.offset, data.size());
+    } else {
+      this->trace_.record(TRACE_MALFORMED, tx.channel, tx.offset, (check << 8) | (data.size() & 0xFF));
+    }
+    ESP_LOGW(TAG, "Malformed response (%u bytes, check %u) for channel %u register %u", 
+             data.size(), check, tx.channel, tx.offset);
+    this->transactions_failed_++;
+    if (tx.probe) {
+      this->finish_probe();
+    }
+    if (tx.is_write) {
+      this->write_failed_callback_.call(tx.channel, tx.offset);
+    }
+    return;
+  }
+  
+  this->transactions_ok_++;
+  this->window_ok_++;
+  
+  if (tx.is_write) {
+    this->trace_.record(TRACE_RESPONSE, tx.channel, tx.offset, tx.value);
+    SENTIO_HOT_LOGD(TAG, "Successfully wrote %u to channel %u register %u (0x%04X)", 
+             tx.value, tx.channel, tx.offset, address);
+    this->received_.push_back(tx);
+    return;
+  }
+  
+  // Decoding is deferred to loop() so it runs within the loop budget
+  for (uint8_t i = 0; i < tx.count; i++) {
+    uint16_t value = get_register_value(data.data(), i);
+    this->trace_.record(TRACE_RESPONSE, tx.channel, tx.offset + i, value);
+    SENTIO_HOT_LOGD(TAG, "Read value %u from channel %u register %u", value, tx.channel, tx.offset + i);
+    
+    Transaction received = tx;
+    received.offset = tx.offset + i;
+    received.count = 1;
+    received.value = value;
+    this->received_.push_back(received);
+  }
+}
+
+void WavinSentio::on_modbus_error(uint8_t function_code, uint8_t exception_code) {
+  if (!this->has_in_flight_) {
+    return;
+  }
+  
+  Transaction tx = this->in_flight_;
+  ExceptionClass exception = classify_exception(exception_code);
+  this->trace_.record(TRACE_EXCEPTION, tx.channel, tx.offset, exception_code);
+  this->has_in_flight_ = false;
+  this->bus_->release(this);
+  
+  // A busy controller is worth asking again, like after a timeout
+  if (exception == EXCEPTION_BUSY && !tx.probe && tx.attempts <= this->max_retries_) {
+    SENTIO_HOT_LOGD(TAG, "Controller busy (0x%02X) for channel %u register %u, retrying", 
+                    exception_code, tx.channel, tx.offset);
+    this->queue_.push_front(tx);
+    return;
+  }
+  
+  ESP_LOGW(TAG, "Modbus exception 0x%02X (function 0x%02X) for channel %u register %u", 
+           exception_code, function_code, tx.channel, tx.offset);
+  this->transactions_failed_++;
+  if (tx.probe) {
+    this->finish_probe();
+  }
+  if (tx.is_write) {
+    this->write_failed_callback_.call(tx.channel, tx.offset);
+  }
+  
+  // The system register map is not confirmed for every firmware, stop asking only
+  // when the controller says the registers do not exist
+  if (tx.channel == SYSTEM_CHANNEL && exception == EXCEPTION_UNSUPPORTED && this->system_supported_) {
+    ESP_LOGW(TAG, "Controller rejects the system registers, system polling disabled");
+    this->system_supported_ = false;
+    this->cancel_interval("system");
   }
 }
 
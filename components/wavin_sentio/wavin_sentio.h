@@ -1,13 +1,29 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/automation.h"
 #include "esphome/components/modbus/modbus.h"
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/sensor/sensor.h"
+#include "bus_arbiter.h"
+#include "codec.h"
+#include "executor.h"
+#include "trace.h"
+#include <deque>
 #include <vector>
 #include <map>
 #include <string>
 
+// Formatted logs in the register hot path are compiled out unless hot_path_logging
+// is enabled, the binary trace covers the same events at a fraction of the cost
+#ifdef WAVIN_SENTIO_HOT_PATH_LOGGING
+#define SENTIO_HOT_LOGD(...) ESP_LOGD(__VA_ARGS__)
+#define SENTIO_HOT_LOGV(...) ESP_LOGV(__VA_ARGS__)
+#else
+#define SENTIO_HOT_LOGD(...)
+#define SENTIO_HOT_LOGV(...)
+#endif
+
 namespace esphome {
 namespace wavin_sentio {
 
@@ -30,6 +46,11 @@ struct ChannelData {
   // Mode/State (from register X02)
   uint16_t mode{0};
   
+  // Decode sequence of the last setpoint write ack and the last setpoint read,
+  // a read is only fresh for a write when its sequence is higher
+  uint32_t setpoint_write_sequence{0};
+  uint32_t setpoint_read_sequence{0};
+  
   // Friendly name
   std::string friendly_name;
   
@@ -37,6 +58,42 @@ struct ChannelData {
   explicit ChannelData(uint8_t id) : channel_id(id) {}
 };
 
+// Bit 0 of the channel masks, no channel uses it: controller diagnostics,
+// set once per throughput window
+static const uint32_t DIAGNOSTICS_MASK = 1UL << 0;
+
+// Entity fed from ChannelData. The parent publishes it from its own loop,
+// within the loop budget, whenever one of its channels received new data.
+class WavinSentioEntity {
+ public:
+  virtual void publish_from_parent() = 0;
+  // Bit N set for every channel N the entity depends on
+  virtual uint32_t get_channel_mask() const = 0;
+};
+
+// Controller-wide state, read as one block from the channel 0 registers
+// and shared by all zones instead of being inferred per channel
+struct SystemData {
+  bool valid{false};
+  float outdoor_temperature{NAN};
+  uint16_t mode{0};  // 1 = heating, 2 = cooling
+  bool blocked{false};
+  uint16_t firmware_version{0};
+  
+  bool is_cooling() const { return this->valid && this->mode == 2; }
+};
+
+// Polling parameters that can be changed at runtime through number entities
+enum TuningParameter : uint8_t {
+  TUNING_UPDATE_INTERVAL = 0,         // s
+  TUNING_SYSTEM_UPDATE_INTERVAL = 1,  // s
+  TUNING_POLL_CHANNELS_PER_CYCLE = 2,
+  TUNING_RESPONSE_TIMEOUT = 3,        // ms
+  TUNING_MAX_RETRIES = 4,
+  TUNING_TEMPERATURE_DEADBAND = 5,    // °C
+  TUNING_HUMIDITY_DEADBAND = 6,       // %
+};
+
 class WavinSentio : public PollingComponent, public modbus::ModbusDevice {
  public:
   WavinSentio() = default;
@@ -53,26 +110,82 @@ class WavinSentio : public PollingComponent, public modbus::ModbusDevice {
   void set_tx_enable_pin(uint8_t pin) { this->tx_enable_pin_ = pin; }
   void set_poll_channels_per_cycle(uint8_t count) { this->poll_channels_per_cycle_ = count; }
   void set_channel_friendly_name(uint8_t channel, const std::string &name);
+  void set_response_timeout(uint32_t timeout_ms) { this->response_timeout_ = timeout_ms; }
+  void set_loop_budget(uint32_t budget_us) { this->executor_.set_budget_us(budget_us); }
+  void set_system_registers(bool enabled) { this->system_registers_ = enabled; }
+  void set_system_update_interval(uint32_t interval_ms) { this->system_update_interval_ = interval_ms; }
+  void set_discovery_timeout(uint32_t timeout_ms) { this->discovery_timeout_ = timeout_ms; }
+  void set_max_retries(uint8_t retries) { this->max_retries_ = retries; }
+  
+  // Runtime tuning - validated, returns false if the value is rejected
+  bool set_tuning(TuningParameter parameter, float value);
+  float get_tuning(TuningParameter parameter) const;
+  float get_temperature_deadband() const { return this->temperature_deadband_; }
+  float get_humidity_deadband() const { return this->humidity_deadband_; }
   
   // Data access methods
   ChannelData* get_channel_data(uint8_t channel);
   bool is_channel_discovered(uint8_t channel);
+  const SystemData &get_system_data() const { return this->system_; }
+  bool is_system_blocked() const { return this->system_.valid && this->system_.blocked; }
+  // Increases with every decoded register value and write ack
+  uint32_t get_decode_sequence() const { return this->decode_sequence_; }
+  
+  // Called when a queued write finally failed (retries exhausted, exception or bad echo)
+  void add_on_write_failed_callback(std::function<void(uint8_t, uint8_t)> &&callback) {
+    this->write_failed_callback_.add(std::move(callback));
+  }
+  
+  // Called once per change of the controller-wide state
+  void add_on_system_change_callback(std::function<void(const SystemData &)> &&callback) {
+    this->system_callback_.add(std::move(callback));
+  }
   
-  // Modbus read/write helpers
-  bool read_register(uint8_t channel, uint8_t offset, uint16_t &value);
+  // Modbus read/write helpers - requests are queued and sent through the shared bus arbiter
+  bool read_register(uint8_t channel, uint8_t offset, uint8_t count = 1);
   bool write_register(uint8_t channel, uint8_t offset, uint16_t value);
   
-  // Register a climate entity
-  void register_climate(climate::Climate *climate_entity, uint8_t channel);
-  void register_climate_group(climate::Climate *climate_entity, const std::vector<uint8_t> &members);
+  // Bus arbiter interface
+  const Transaction *peek_transaction() const;
+  bool dispatch_transaction();
+  void on_transaction_timeout();
+  uint32_t get_response_timeout() const {
+    return this->in_flight_.probe ? this->discovery_timeout_ : this->response_timeout_;
+  }
+  bool is_discovering() const { return this->discovery_remaining_ > 0; }
+  uint8_t get_address() const { return this->address_; }
+  
+  // Throughput statistics
+  uint32_t get_transactions_ok() const { return this->transactions_ok_; }
+  uint32_t get_transactions_failed() const { return this->transactions_failed_; }
+  float get_throughput() const { return this->throughput_; }
+  uint32_t get_loop_budget_overruns() const { return this->executor_.get_overruns(); }
+  uint32_t get_loop_budget_exhausted() const { return this->executor_.get_exhausted(); }
+  uint32_t get_loop_max_run_us() const { return this->executor_.get_max_run_us(); }
+  
+  // Binary trace of register events, decode the dump with tools/decode_trace.py
+  void dump_trace() const { this->trace_.dump("wavin_sentio", this->address_); }
+  void clear_trace() { this->trace_.clear(); }
+  
+  // Register a sensor or climate entity to be published when its channels update
+  void register_entity(WavinSentioEntity *entity);
   
   // ModbusDevice interface
   void on_modbus_data(const std::vector<uint8_t> &data) override;
+  void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   
  protected:
   void poll_channel(uint8_t channel);
+  void poll_system();
+  void handle_system_value(uint8_t offset, uint16_t raw_value);
   void discover_channels();
+  void finish_probe();
   uint16_t get_register_address(uint8_t channel, uint8_t offset);
+  void handle_register_value(uint8_t channel, uint8_t offset, uint16_t raw_value);
+  int find_next_transaction() const;
+  bool decode_step();
+  bool publish_step();
+  void update_throughput();
   
   optional<uint8_t> flow_control_pin_{};
   optional<uint8_t> tx_enable_pin_{};
@@ -82,9 +195,61 @@ class WavinSentio : public PollingComponent, public modbus::ModbusDevice {
   std::map<uint8_t, ChannelData> channels_;
   std::map<uint8_t, std::string> friendly_names_;
   
+  // Transaction queue, drained by the shared bus arbiter
+  WavinSentioBus *bus_{nullptr};
+  std::deque<Transaction> queue_;
+  Transaction in_flight_;
+  bool has_in_flight_{false};
+  uint32_t response_timeout_{300};
+  
+  // Cooperative work done in loop(), bounded by the loop budget
+  CooperativeExecutor executor_;
+  std::deque<Transaction> received_;
+  std::vector<WavinSentioEntity *> entities_;
+  uint32_t dirty_channels_{0};
+  uint32_t decode_sequence_{0};
+  uint32_t publishing_channels_{0};
+  size_t publish_cursor_{0};
+  
+  TraceBuffer trace_;
+  
+  // Controller-wide registers, polled at a lower cadence than the channels
+  SystemData system_;
+  SystemData pending_system_;
+  uint32_t system_update_interval_{60000};
+  bool system_registers_{false};  // Opt-in, the channel 0 map is assumed
+  bool system_supported_{true};   // Cleared when the controller rejects the block
+  CallbackManager<void(const SystemData &)> system_callback_;
+  CallbackManager<void(uint8_t, uint8_t)> write_failed_callback_;
+  
+  // Startup discovery burst
+  uint32_t discovery_timeout_{100};
+  uint8_t discovery_remaining_{0};
+  uint32_t discovery_start_{0};
+  
   // Retry logic
-  uint8_t retry_count_{0};
-  static constexpr uint8_t MAX_RETRIES = 2;
+  uint8_t max_retries_{1};  // Retries after the first attempt
+  
+  // Sensors skip publishing changes smaller than these
+  float temperature_deadband_{0.0f};
+  float humidity_deadband_{0.0f};
+  
+  static constexpr size_t MAX_QUEUE_SIZE = 64;
+  
+  // Throughput statistics
+  uint32_t transactions_ok_{0};
+  uint32_t transactions_failed_{0};
+  uint32_t window_start_{0};
+  uint32_t window_ok_{0};
+  float throughput_{0.0f};
+};
+
+// on_system_change automation, fired once per change of system mode or blocking state
+class SystemChangeTrigger : public Trigger<const SystemData &> {
+ public:
+  explicit SystemChangeTrigger(WavinSentio *parent) {
+    parent->add_on_system_change_callback([this](const SystemData &data) { this->trigger(data); });
+  }
 };
 
 }  // namespace wavin_sentio
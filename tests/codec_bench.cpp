@@ -0,0 +1,43 @@
+// Per-frame decode throughput: check a 3 register channel block and decode it,
+// the work done for every polled channel. Usage: codec_bench [frames]
+#include "codec.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace esphome::wavin_sentio;
+
+int main(int argc, char **argv) {
+  const unsigned long frames = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+
+  // Air temperature, floor temperature, humidity with varying values
+  std::vector<uint8_t> data(64 * 6);
+  for (size_t i = 0; i < data.size(); i += 2) {
+    uint16_t raw = 1500 + (i * 37) % 3000;
+    data[i] = raw >> 8;
+    data[i + 1] = raw & 0xFF;
+  }
+
+  volatile float sink = 0;
+  size_t rejected = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned long n = 0; n < frames; n++) {
+    const uint8_t *frame = data.data() + (n % 64) * 6;
+    if (check_read_response(frame, 6, 3) != RESPONSE_OK) {
+      rejected++;
+      continue;
+    }
+    float air = decode_air_temperature(get_register_value(frame, 0));
+    float floor = decode_floor_temperature(get_register_value(frame, 1));
+    float humidity = decode_humidity(get_register_value(frame, 2));
+    sink = sink + air + floor + humidity;
+  }
+  const double elapsed =
+      std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  printf("codec_bench: %lu frames, %.1f ns/frame, %.2f Mframes/s\n", frames, elapsed / frames,
+         frames / elapsed * 1000.0);
+  return rejected == 0 ? 0 : 1;
+}
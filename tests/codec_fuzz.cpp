@@ -0,0 +1,59 @@
+// libFuzzer entry point for the response checks, exception classification and
+// register decoders.
+//
+// Input layout: count (also the exception code), address (2), value (2), then
+// the payload as handed to on_modbus_data(). The payload is copied to an
+// exact-size buffer so the sanitizers catch any read past the end.
+#include "codec.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace esphome::wavin_sentio;
+
+static void check_decoded(float value, float low, float high) {
+  if (!std::isnan(value) && (value < low || value > high)) {
+    abort();
+  }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size < 5) {
+    return 0;
+  }
+  const uint8_t count = data[0];
+  const uint16_t address = (data[1] << 8) | data[2];
+  const uint16_t value = (data[3] << 8) | data[4];
+  if (classify_exception(data[0]) > EXCEPTION_FAILED) {
+    abort();
+  }
+  const std::vector<uint8_t> payload(data + 5, data + size);
+  // Empty vectors may return nullptr, that is a valid input too
+  const uint8_t *bytes = payload.empty() ? nullptr : payload.data();
+
+  ResponseCheck read = check_read_response(bytes, payload.size(), count);
+  if (read == RESPONSE_OK) {
+    if (count == 0 || payload.size() != static_cast<size_t>(count) * 2) {
+      abort();
+    }
+    for (size_t i = 0; i < count; i++) {
+      uint16_t raw = get_register_value(bytes, i);
+      check_decoded(decode_air_temperature(raw), 5.0f, 50.0f);
+      check_decoded(decode_floor_temperature(raw), 1.0f, 90.0f);
+      check_decoded(decode_humidity(raw), 0.0f, 100.0f);
+      check_decoded(decode_setpoint(raw), 5.0f, 35.0f);
+      check_decoded(decode_outdoor_temperature(raw), -50.0f, 70.0f);
+    }
+  } else if (read == RESPONSE_BAD_ECHO) {
+    abort();
+  }
+
+  ResponseCheck write = check_write_response(bytes, payload.size(), address, value);
+  if (write == RESPONSE_OK) {
+    if (payload.size() != 4 || get_register_value(bytes, 0) != address || get_register_value(bytes, 1) != value) {
+      abort();
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,190 @@
+// Property tests for the response checks and register decoders in codec.cpp
+#include "codec.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace esphome::wavin_sentio;
+
+static int failures = 0;
+
+#define CHECK(expr) \
+  do { \
+    if (!(expr)) { \
+      printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+      failures++; \
+    } \
+  } while (0)
+
+static bool near(float value, float expected) { return !std::isnan(value) && std::fabs(value - expected) < 0.001f; }
+
+static std::vector<uint8_t> frame(std::initializer_list<uint16_t> registers) {
+  std::vector<uint8_t> data;
+  for (uint16_t reg : registers) {
+    data.push_back(reg >> 8);
+    data.push_back(reg & 0xFF);
+  }
+  return data;
+}
+
+// Every raw value decodes to NAN or raw / 100 inside the window, and the
+// accepted values form one contiguous range
+static void check_window(float (*decode)(uint16_t), bool is_signed, float low, float high) {
+  int transitions = 0;
+  bool previous = false;
+  for (int i = is_signed ? INT16_MIN : 0; i <= (is_signed ? INT16_MAX : UINT16_MAX); i++) {
+    const uint16_t raw = static_cast<uint16_t>(i);
+    const float value = decode(raw);
+    const bool accepted = !std::isnan(value);
+    if (accepted) {
+      CHECK(value >= low && value <= high);
+      CHECK(near(value, i / 100.0f));
+    }
+    if (accepted != previous) {
+      transitions++;
+    }
+    previous = accepted;
+  }
+  CHECK(transitions == 2);
+}
+
+static void test_air_temperature() {
+  CHECK(std::isnan(decode_air_temperature(500)));
+  CHECK(near(decode_air_temperature(501), 5.01f));
+  CHECK(near(decode_air_temperature(2150), 21.5f));
+  CHECK(near(decode_air_temperature(4999), 49.99f));
+  CHECK(std::isnan(decode_air_temperature(5000)));
+  CHECK(std::isnan(decode_air_temperature(0)));
+  CHECK(std::isnan(decode_air_temperature(0xFFFF)));
+  check_window(decode_air_temperature, false, 5.0f, 50.0f);
+}
+
+static void test_floor_temperature() {
+  CHECK(std::isnan(decode_floor_temperature(100)));
+  CHECK(near(decode_floor_temperature(101), 1.01f));
+  CHECK(near(decode_floor_temperature(8999), 89.99f));
+  CHECK(std::isnan(decode_floor_temperature(9000)));
+  // No floor probe connected
+  CHECK(std::isnan(decode_floor_temperature(0)));
+  check_window(decode_floor_temperature, false, 1.0f, 90.0f);
+}
+
+static void test_humidity() {
+  CHECK(near(decode_humidity(0), 0.0f));
+  CHECK(near(decode_humidity(10000), 100.0f));
+  CHECK(std::isnan(decode_humidity(10001)));
+  CHECK(std::isnan(decode_humidity(0xFFFF)));
+  check_window(decode_humidity, false, 0.0f, 100.0f);
+}
+
+static void test_setpoint() {
+  CHECK(std::isnan(decode_setpoint(500)));
+  CHECK(near(decode_setpoint(501), 5.01f));
+  CHECK(near(decode_setpoint(3499), 34.99f));
+  CHECK(std::isnan(decode_setpoint(3500)));
+  check_window(decode_setpoint, false, 5.0f, 35.0f);
+}
+
+static void test_outdoor_temperature() {
+  CHECK(near(decode_outdoor_temperature(0), 0.0f));
+  CHECK(near(decode_outdoor_temperature(0xFFFF), -0.01f));
+  CHECK(near(decode_outdoor_temperature(static_cast<uint16_t>(-1250)), -12.5f));
+  CHECK(near(decode_outdoor_temperature(static_cast<uint16_t>(-4999)), -49.99f));
+  CHECK(std::isnan(decode_outdoor_temperature(static_cast<uint16_t>(-5000))));
+  CHECK(near(decode_outdoor_temperature(6999), 69.99f));
+  CHECK(std::isnan(decode_outdoor_temperature(7000)));
+  // No sensor connected reads as the extremes
+  CHECK(std::isnan(decode_outdoor_temperature(0x8000)));
+  CHECK(std::isnan(decode_outdoor_temperature(0x7FFF)));
+  check_window(decode_outdoor_temperature, true, -50.0f, 70.0f);
+}
+
+static void test_read_response() {
+  const std::vector<uint8_t> three = frame({2150, 2300, 4500});
+  CHECK(check_read_response(three.data(), three.size(), 3) == RESPONSE_OK);
+  CHECK(get_register_value(three.data(), 0) == 2150);
+  CHECK(get_register_value(three.data(), 2) == 4500);
+
+  // Short payloads, including odd lengths
+  for (size_t size = 0; size < three.size(); size++) {
+    CHECK(check_read_response(three.data(), size, 3) == RESPONSE_SHORT);
+  }
+  CHECK(check_read_response(nullptr, 0, 1) == RESPONSE_SHORT);
+  CHECK(check_read_response(nullptr, 6, 3) == RESPONSE_SHORT);
+
+  // Oversized payloads mean the framing is off
+  CHECK(check_read_response(three.data(), three.size(), 2) == RESPONSE_LENGTH);
+  CHECK(check_read_response(three.data(), three.size(), 1) == RESPONSE_LENGTH);
+  CHECK(check_read_response(three.data(), 3, 1) == RESPONSE_LENGTH);
+
+  // A zero count request never has a valid answer
+  CHECK(check_read_response(three.data(), 0, 0) == RESPONSE_SHORT);
+  CHECK(check_read_response(three.data(), three.size(), 0) == RESPONSE_SHORT);
+
+  // Largest count the arbiter can request
+  std::vector<uint8_t> large(255 * 2, 0x11);
+  CHECK(check_read_response(large.data(), large.size(), 255) == RESPONSE_OK);
+  CHECK(check_read_response(large.data(), large.size() - 1, 255) == RESPONSE_SHORT);
+}
+
+static void test_write_response() {
+  const std::vector<uint8_t> echo = frame({0x0113, 2150});
+  CHECK(check_write_response(echo.data(), echo.size(), 0x0113, 2150) == RESPONSE_OK);
+
+  for (size_t size = 0; size < echo.size(); size++) {
+    CHECK(check_write_response(echo.data(), size, 0x0113, 2150) == RESPONSE_SHORT);
+  }
+  CHECK(check_write_response(nullptr, 4, 0x0113, 2150) == RESPONSE_SHORT);
+
+  const std::vector<uint8_t> longer = frame({0x0113, 2150, 0});
+  CHECK(check_write_response(longer.data(), 5, 0x0113, 2150) == RESPONSE_LENGTH);
+  CHECK(check_write_response(longer.data(), longer.size(), 0x0113, 2150) == RESPONSE_LENGTH);
+
+  // Any flipped bit in the echo is rejected
+  for (size_t bit = 0; bit < 32; bit++) {
+    std::vector<uint8_t> bad = echo;
+    bad[bit / 8] ^= 1 << (bit % 8);
+    CHECK(check_write_response(bad.data(), bad.size(), 0x0113, 2150) == RESPONSE_BAD_ECHO);
+  }
+  CHECK(check_write_response(echo.data(), echo.size(), 0x0114, 2150) == RESPONSE_BAD_ECHO);
+  CHECK(check_write_response(echo.data(), echo.size(), 0x0113, 2100) == RESPONSE_BAD_ECHO);
+}
+
+static void test_exceptions() {
+  CHECK(classify_exception(0x01) == EXCEPTION_UNSUPPORTED);
+  CHECK(classify_exception(0x02) == EXCEPTION_UNSUPPORTED);
+  CHECK(classify_exception(0x03) == EXCEPTION_FAILED);
+  CHECK(classify_exception(0x04) == EXCEPTION_FAILED);
+  CHECK(classify_exception(0x05) == EXCEPTION_BUSY);
+  CHECK(classify_exception(0x06) == EXCEPTION_BUSY);
+  CHECK(classify_exception(0x0B) == EXCEPTION_FAILED);
+
+  // Only the two address/function codes may ever stop polling
+  int unsupported = 0;
+  for (int code = 0; code <= 0xFF; code++) {
+    ExceptionClass result = classify_exception(code);
+    CHECK(result <= EXCEPTION_FAILED);
+    if (result == EXCEPTION_UNSUPPORTED) {
+      unsupported++;
+    }
+  }
+  CHECK(unsupported == 2);
+}
+
+int main() {
+  test_air_temperature();
+  test_floor_temperature();
+  test_humidity();
+  test_setpoint();
+  test_outdoor_temperature();
+  test_read_response();
+  test_write_response();
+  test_exceptions();
+
+  if (failures > 0) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All codec checks passed\n");
+  return 0;
+}
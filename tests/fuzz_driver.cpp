@@ -0,0 +1,53 @@
+// Standalone driver for compilers without libFuzzer: feeds random inputs to
+// LLVMFuzzerTestOneInput. Usage: codec_fuzz [iterations] [seed]
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int main(int argc, char **argv) {
+  const unsigned long iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 100000;
+  const unsigned long seed = argc > 2 ? strtoul(argv[2], nullptr, 10) : std::random_device{}();
+  printf("codec_fuzz: %lu iterations, seed %lu\n", iterations, seed);
+
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<int> length(0, 64);
+  std::vector<uint8_t> input;
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    input.resize(length(rng));
+    for (auto &b : input) {
+      b = byte(rng);
+    }
+    // Bias towards well-formed frames, otherwise OK responses are rare
+    if (input.size() >= 5) {
+      switch (i % 4) {
+        case 1:  // Read frame matching its count, count 0 included
+          input[0] &= 0x07;
+          input.resize(5 + input[0] * 2);
+          for (size_t j = 5; j < input.size(); j++) {
+            input[j] = byte(rng);
+          }
+          break;
+        case 2:  // Correct write echo
+        case 3:  // Write echo with one flipped bit
+          input.resize(9);
+          for (size_t j = 0; j < 4; j++) {
+            input[5 + j] = input[1 + j];
+          }
+          if (i % 4 == 3) {
+            input[5 + byte(rng) % 4] ^= 1 << (byte(rng) % 8);
+          }
+          break;
+        default:
+          break;
+      }
+    }
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Decode Wavin Sentio binary trace dumps from an ESPHome log.
+
+Trigger a dump on the device with `id(sentio).dump_trace();` (e.g. from a button
+lambda), save the log output and run:
+
+    python3 tools/decode_trace.py device.log
+
+Lines not belonging to a trace dump are ignored, so a full log can be passed in.
+"""
+import re
+import struct
+import sys
+
+# Must stay in sync with TraceEvent in components/wavin_sentio/trace.h
+EVENTS = {
+    1: "READ_SENT",
+    2: "WRITE_SENT",
+    3: "RESPONSE",
+    4: "TIMEOUT",
+    5: "EXCEPTION",
+    6: "SHORT_RESPONSE",
+    7: "REJECTED",
+    8: "DISCOVERED",
+    9: "SYSTEM_CHANGE",
+    10: "MALFORMED",
+}
+
+RECORD_FORMAT = "<IBBBH"  # timestamp, channel, offset, event, value
+RECORD_BYTES = struct.calcsize(RECORD_FORMAT)
+
+BEGIN_RE = re.compile(r"SENTIO-TRACE BEGIN v(\d+) address=(0x[0-9A-Fa-f]+) records=(\d+)")
+DATA_RE = re.compile(r"SENTIO-TRACE ([0-9a-f]+)")
+END_RE = re.compile(r"SENTIO-TRACE END")
+
+
+def decode_dump(address, payload):
+    records = [
+        struct.unpack_from(RECORD_FORMAT, payload, i)
+        for i in range(0, len(payload) - RECORD_BYTES + 1, RECORD_BYTES)
+    ]
+    if not records:
+        return
+
+    print(f"Controller {address}: {len(records)} records")
+    print(f"{'t (ms)':>10} {'dt (us)':>9}  {'ch':>2} {'reg':>4}  {'event':<15} value")
+    first = records[0][0]
+    previous = first
+    for timestamp, channel, offset, event, value in records:
+        # micros() wraps every ~71 minutes
+        elapsed = (timestamp - first) & 0xFFFFFFFF
+        delta = (timestamp - previous) & 0xFFFFFFFF
+        previous = timestamp
+        name = EVENTS.get(event, f"UNKNOWN({event})")
+        register = channel * 100 + offset
+        print(f"{elapsed / 1000:10.3f} {delta:9d}  {channel:2d} {register:4d}  {name:<15} {value}")
+    print()
+
+
+def main(argv):
+    stream = open(argv[1], encoding="utf-8", errors="replace") if len(argv) > 1 else sys.stdin
+
+    address = None
+    payload = bytearray()
+    for line in stream:
+        match = BEGIN_RE.search(line)
+        if match:
+            if match.group(1) != "1":
+                sys.exit(f"Unsupported trace format version {match.group(1)}")
+            address = match.group(2)
+            payload = bytearray()
+            continue
+
+        if address is None:
+            continue
+
+        if END_RE.search(line):
+            decode_dump(address, payload)
+            address = None
+            continue
+
+        match = DATA_RE.search(line)
+        if match:
+            payload += bytes.fromhex(match.group(1))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))